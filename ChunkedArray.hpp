@@ -1,11 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <cassert>
 #include <memory>
 #include <new>
+#include <ranges>
 #include <stdexcept>
 #include <span>
 #include <type_traits>
@@ -46,6 +52,21 @@ namespace entable {
     };
 
 
+    // Snapshot of a ChunkedArray's memory use, see ChunkedArray::memory_stats().
+    struct ChunkedArrayStats
+    {
+        size_t allocated_bytes  = 0;  // chunk storage, live or not
+        size_t live_bytes       = 0;  // size() * sizeof(T)
+        size_t chunk_count      = 0;  // allocated chunks
+        size_t live_chunk_count = 0;  // chunks holding at least one element
+        size_t index_bytes      = 0;  // capacity of the chunk pointer table
+    };
+
+
+    // Default chunk alignment: a cache line.
+    static constexpr size_t DEFAULT_CHUNK_ALIGN = 64;
+
+
     // Chunked array with std::vector-like API.
     //
     // Memory is allocated in fixed-size chunks so that:
@@ -56,9 +77,33 @@ namespace entable {
     // that T is NOT required to be default-constructible for pop_back or shrinking.
     //
     // CHUNK_SIZE must be a power of two (enforced by static_assert).
-    template <class T, size_t CHUNK_SIZE = 128>
+    //
+    // Every chunk starts on a CHUNK_ALIGN boundary (a power of two up to 4096;
+    // raised to alignof(T) if smaller), by default a cache line. Chunk pointers
+    // and the data() of chunk spans can be marked as such for the optimizer
+    // with assume_chunk_aligned().
+    //
+    // GROW_FIRST_CHUNK suits many small arrays: the first chunk starts at 8
+    // elements and doubles up to CHUNK_SIZE before further chunks are added, so
+    // a 3-element array does not cost a whole chunk. Indexing is unchanged.
+    // While the first chunk grows its elements are moved, so pointers into it
+    // are invalidated by growth until the array reaches CHUNK_SIZE elements.
+    //
+    // COPY_ON_WRITE makes chunks reference counted: fork() returns an array
+    // sharing every chunk in O(chunk count), and a shared chunk is copied on
+    // the first mutable access to it (non-const operator[], mutable iterators
+    // and chunk spans, emplace_back into it, ...). Const access never copies.
+    // Writing through a pointer obtained before fork() is undefined, as the
+    // chunk may now be shared. T must be trivially copyable.
+    template <class T, size_t CHUNK_SIZE = 128, size_t CHUNK_ALIGN = DEFAULT_CHUNK_ALIGN, bool GROW_FIRST_CHUNK = false,
+              bool COPY_ON_WRITE = false>
     class ChunkedArray
     {
+        static_assert(std::has_single_bit(CHUNK_ALIGN) && CHUNK_ALIGN <= 4096,
+            "CHUNK_ALIGN must be a power of two no larger than 4096");
+        static_assert(!COPY_ON_WRITE || std::is_trivially_copyable_v<T>,
+            "COPY_ON_WRITE requires a trivially copyable T");
+
     public:
         using value_type      = T;
         using size_type       = size_t;
@@ -68,6 +113,11 @@ namespace entable {
         using pointer         = T*;
         using const_pointer   = const T*;
 
+        static constexpr size_t chunk_size      = CHUNK_SIZE;
+        static constexpr size_t chunk_alignment = CHUNK_ALIGN > alignof(T) ? CHUNK_ALIGN : alignof(T);
+        // Smallest first chunk in GROW_FIRST_CHUNK mode.
+        static constexpr size_t min_first_chunk = CHUNK_SIZE < 8 ? CHUNK_SIZE : 8;
+
     private:
         using Helper = ChunkHelper<CHUNK_SIZE>;
 
@@ -105,7 +155,7 @@ namespace entable {
 
             // Reload current/chunk_end/chunk_start for the current chunk_index.
             // Uses cached array_size — no access to array->size() or array->chunk_count().
-            void reload_chunk() noexcept {
+            void reload_chunk() noexcept(IsConst || !COPY_ON_WRITE) {
                 const size_t chunk_base = chunk_index * CHUNK_SIZE;
                 if (chunk_base < array_size) [[likely]] {
                     chunk_start = array->get_chunk_ptr(chunk_index);
@@ -122,7 +172,7 @@ namespace entable {
 
             // Position the iterator at absolute index idx.
             // idx == array_size yields end(); idx > array_size is undefined.
-            void reload_from_index(size_t idx) noexcept {
+            void reload_from_index(size_t idx) noexcept(IsConst || !COPY_ON_WRITE) {
                 if (idx < array_size) [[likely]] {
                     chunk_index             = Helper::ChunkIndex(idx);
                     chunk_start             = array->get_chunk_ptr(chunk_index);
@@ -307,6 +357,7 @@ namespace entable {
             , elemCount(std::exchange(other.elemCount, 0))
             , m_writePtr(std::exchange(other.m_writePtr, nullptr))
             , m_chunkEnd(std::exchange(other.m_chunkEnd, nullptr))
+            , m_headCapacity(std::exchange(other.m_headCapacity, {}))
         {}
 
         ChunkedArray& operator=(ChunkedArray&& other) noexcept {
@@ -316,10 +367,41 @@ namespace entable {
                 elemCount  = std::exchange(other.elemCount, 0);
                 m_writePtr = std::exchange(other.m_writePtr, nullptr);
                 m_chunkEnd = std::exchange(other.m_chunkEnd, nullptr);
+                m_headCapacity = std::exchange(other.m_headCapacity, {});
             }
             return *this;
         }
 
+        // Explicit deep copy (copying is deleted so it never happens by accident).
+        // Chunks are allocated once and filled by append_range, i.e. one memcpy
+        // per chunk for trivially copyable T. Capacity beyond size() is not
+        // reproduced.
+        [[nodiscard]] ChunkedArray clone() const {
+            ChunkedArray copy;
+            copy.reserve(elemCount);
+            for_each_chunk([&copy](std::span<const T> chunk) { copy.append_range(chunk); });
+            return copy;
+        }
+
+        // Copy-on-write copy: shares every chunk with this array in O(chunk
+        // count); whichever array writes to a shared chunk first copies it.
+        [[nodiscard]] ChunkedArray fork() requires COPY_ON_WRITE {
+            ChunkedArray copy;
+            copy.chunks         = chunks;
+            copy.elemCount      = elemCount;
+            copy.m_headCapacity = m_headCapacity;
+            // The write chunk is shared now: both arrays must detach before appending.
+            update_write_ptr();
+            copy.update_write_ptr();
+            return copy;
+        }
+
+        // Chunks also referenced by a fork; O(chunk count).
+        [[nodiscard]] size_t shared_chunk_count() const noexcept requires COPY_ON_WRITE {
+            return static_cast<size_t>(std::count_if(chunks.begin(), chunks.end(),
+                [](const ChunkPtr& c) { return c.use_count() > 1; }));
+        }
+
         // -----------------------------------------------------------------------
         // Capacity
         // -----------------------------------------------------------------------
@@ -330,6 +412,7 @@ namespace entable {
             chunks.clear();
             m_writePtr = nullptr;
             m_chunkEnd = nullptr;
+            m_headCapacity = {};
         }
 
         // Resets the logical size to zero without releasing chunk memory or
@@ -349,10 +432,8 @@ namespace entable {
         // Pre-allocates chunk memory for at least count elements without constructing any.
         void reserve(size_t count) {
             if (count == 0) return;
-            const size_t needed = Helper::ChunkIndex(count - 1) + 1;
-            chunks.reserve(needed);
-            while (chunks.size() < needed)
-                chunks.push_back(make_chunk());
+            chunks.reserve(Helper::ChunkIndex(count - 1) + 1);
+            allocate_chunks_for(count);
             update_write_ptr();
         }
 
@@ -364,7 +445,9 @@ namespace entable {
         }
 
         // Number of elements that can be held in currently allocated chunk storage.
-        [[nodiscard]] size_t capacity()    const noexcept { return chunks.size() * CHUNK_SIZE; }
+        [[nodiscard]] size_t capacity()    const noexcept {
+            return chunks.empty() ? 0 : (chunks.size() - 1) * CHUNK_SIZE + head_capacity();
+        }
         [[nodiscard]] bool   empty()       const noexcept { return elemCount == 0; }
         [[nodiscard]] size_t size()        const noexcept { return elemCount; }
         // Returns the number of allocated chunks, which may exceed the number of
@@ -372,6 +455,17 @@ namespace entable {
         // for_each_chunk() to iterate only over chunks with live data.
         [[nodiscard]] size_t chunk_count() const noexcept { return chunks.size(); }
 
+        // O(1) memory accounting, cheap enough to poll every frame.
+        [[nodiscard]] ChunkedArrayStats memory_stats() const noexcept {
+            ChunkedArrayStats stats;
+            stats.allocated_bytes  = capacity() * sizeof(T);
+            stats.live_bytes       = elemCount * sizeof(T);
+            stats.chunk_count      = chunks.size();
+            stats.live_chunk_count = elemCount > 0 ? Helper::ChunkIndex(elemCount - 1) + 1 : 0;
+            stats.index_bytes      = chunks.capacity() * sizeof(ChunkPtr);
+            return stats;
+        }
+
         // Grow to exactly count elements, default-constructing any new ones.
         void ensure_size(size_t count)
             requires std::is_default_constructible_v<T>
@@ -386,12 +480,17 @@ namespace entable {
 
         // Releases chunk memory allocated beyond what is needed to hold elemCount elements.
         // reserve() never constructs elements, so no destruction is needed before freeing
-        // surplus chunks.
+        // surplus chunks. In GROW_FIRST_CHUNK mode a lone first chunk is also
+        // reallocated down to the smallest step that holds the elements.
         void shrink_to_fit() {
             const size_t needed = elemCount > 0
                 ? Helper::ChunkIndex(elemCount - 1) + 1 : 0;
             chunks.resize(needed);
             chunks.shrink_to_fit();
+            if constexpr (GROW_FIRST_CHUNK) {
+                if (chunks.size() == 1 && first_chunk_step(elemCount) < m_headCapacity)
+                    resize_head(first_chunk_step(elemCount));
+            }
             update_write_ptr();
         }
 
@@ -409,11 +508,7 @@ namespace entable {
 
         void resize(size_t count, const T& value) {
             if (count > elemCount) {
-                const size_t old_count = elemCount;
-                allocate_chunks_for(count);
-                construct_range(old_count, count, [&value](T* base, size_t lo, size_t hi) {
-                    std::uninitialized_fill(base + lo, base + hi, value);
-                });
+                append_n(count - elemCount, value);
             } else if (count < elemCount) {
                 destroy_elements(count, elemCount);
                 elemCount = count;
@@ -425,7 +520,7 @@ namespace entable {
         // Element access
         // -----------------------------------------------------------------------
 
-        FORCE_INLINE decltype(auto) operator[](size_t idx)       { return chunks[Helper::ChunkIndex(idx)].get()[Helper::OffsetIndex(idx)]; }
+        FORCE_INLINE decltype(auto) operator[](size_t idx)       { return writable_chunk(Helper::ChunkIndex(idx))[Helper::OffsetIndex(idx)]; }
         FORCE_INLINE decltype(auto) operator[](size_t idx) const { return chunks[Helper::ChunkIndex(idx)].get()[Helper::OffsetIndex(idx)]; }
 
         FORCE_INLINE decltype(auto) at(size_t idx) {
@@ -463,6 +558,11 @@ namespace entable {
         void pop_back() noexcept(std::is_nothrow_destructible_v<T>) {
             assert(elemCount > 0);
             --elemCount;
+            if constexpr (COPY_ON_WRITE) {
+                // The write chunk may be shared; let update_write_ptr decide.
+                update_write_ptr();
+                return;
+            }
             if constexpr (!std::is_trivially_destructible_v<T>)
                 std::destroy_at(std::addressof((*this)[elemCount]));
             // Fast path: the freed slot and the new write position are in the same
@@ -479,13 +579,53 @@ namespace entable {
             }
         }
 
+        // Bulk appends: chunks are allocated once up front and each chunk is filled
+        // with a single uninitialized_copy / uninitialized_fill (a memcpy for
+        // trivially copyable T from a contiguous source). If a constructor throws,
+        // the elements appended so far are destroyed and the array is left as it
+        // was (surplus chunks are kept as capacity).
+
+        void append_n(size_t count, const T& value) {
+            append_with(count, [&value](T* base, size_t lo, size_t hi) {
+                std::uninitialized_fill(base + lo, base + hi, value);
+            });
+        }
+
+        template<std::ranges::input_range R>
+            requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        void append_range(R&& range) {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>) {
+                const size_t count = static_cast<size_t>(std::ranges::distance(range));
+                append_copy_n(std::ranges::begin(range), count);
+            } else {
+                // Single-pass source of unknown length: fall back to emplace_back
+                const size_t old_count = elemCount;
+                try {
+                    for (auto&& value : range)
+                        emplace_back(std::forward<decltype(value)>(value));
+                } catch (...) {
+                    truncate(old_count);
+                    throw;
+                }
+            }
+        }
+
+        // Replaces the contents with [first, last). Chunks are reused. Gives the
+        // basic guarantee only: if a constructor throws, the array is left empty.
+        template<std::input_iterator It, std::sentinel_for<It> S>
+            requires std::constructible_from<T, std::iter_reference_t<It>>
+        void assign(It first, S last) {
+            truncate(0);
+            append_range(std::ranges::subrange(std::move(first), std::move(last)));
+        }
+
         // Removes the element at idx in O(1) by moving the last element into the
         // vacated slot and popping the (now-duplicate) tail.
         // Invalidates any iterator or index pointing to the last element.
         // Intended as the building block for stable-index or sparse-set layers above
         // this class, which can intercept the move to update their own bookkeeping.
         void swap_remove(size_t idx)
-            noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>)
+            noexcept(!COPY_ON_WRITE && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>)
         {
             assert(idx < elemCount && "swap_remove index out of range");
             if (idx != elemCount - 1)
@@ -497,14 +637,23 @@ namespace entable {
         // Chunk access
         // -----------------------------------------------------------------------
 
-        T*       get_chunk_ptr(size_t chunk_idx)       noexcept { return chunks[chunk_idx].get(); }
-        const T* get_chunk_ptr(size_t chunk_idx) const noexcept { return chunks[chunk_idx].get(); }
+        T*       get_chunk_ptr(size_t chunk_idx)       noexcept(!COPY_ON_WRITE) { return assume_chunk_aligned(writable_chunk(chunk_idx)); }
+        const T* get_chunk_ptr(size_t chunk_idx) const noexcept { return assume_chunk_aligned(chunks[chunk_idx].get()); }
+
+        // Tells the optimizer that p is the start of a chunk, e.g. the data() of
+        // a span from get_chunk_span / for_each_chunk, so loops over it can use
+        // aligned vector loads without a peeling prologue. p must be one.
+        template<typename U>
+        [[nodiscard]] FORCE_INLINE static U* assume_chunk_aligned(U* p) noexcept {
+            assert(reinterpret_cast<std::uintptr_t>(p) % chunk_alignment == 0);
+            return std::assume_aligned<chunk_alignment>(p);
+        }
 
-        std::span<T> get_chunk_span(size_t chunk_idx) noexcept {
+        std::span<T> get_chunk_span(size_t chunk_idx) noexcept(!COPY_ON_WRITE) {
             if (chunk_idx >= chunks.size()) [[unlikely]] return {};
             const size_t chunk_base = chunk_idx * CHUNK_SIZE;
             if (chunk_base >= elemCount) [[unlikely]] return {};
-            return {chunks[chunk_idx].get(), std::min(CHUNK_SIZE, elemCount - chunk_base)};
+            return {writable_chunk(chunk_idx), std::min(CHUNK_SIZE, elemCount - chunk_base)};
         }
 
         std::span<const T> get_chunk_span(size_t chunk_idx) const noexcept {
@@ -540,8 +689,8 @@ namespace entable {
             if (elemCount == 0) [[unlikely]] return;
             const size_t live = Helper::ChunkIndex(elemCount - 1) + 1;
             for (size_t c = 0; c + 1 < live; ++c)
-                f(std::span<T>(chunks[c].get(), CHUNK_SIZE));
-            f(std::span<T>(chunks[live - 1].get(), elemCount - (live - 1) * CHUNK_SIZE));
+                f(std::span<T>(get_chunk_ptr(c), CHUNK_SIZE));
+            f(std::span<T>(get_chunk_ptr(live - 1), elemCount - (live - 1) * CHUNK_SIZE));
         }
 
         template<typename F>
@@ -549,8 +698,8 @@ namespace entable {
             if (elemCount == 0) [[unlikely]] return;
             const size_t live = Helper::ChunkIndex(elemCount - 1) + 1;
             for (size_t c = 0; c + 1 < live; ++c)
-                f(std::span<const T>(chunks[c].get(), CHUNK_SIZE));
-            f(std::span<const T>(chunks[live - 1].get(), elemCount - (live - 1) * CHUNK_SIZE));
+                f(std::span<const T>(get_chunk_ptr(c), CHUNK_SIZE));
+            f(std::span<const T>(get_chunk_ptr(live - 1), elemCount - (live - 1) * CHUNK_SIZE));
         }
 
         // Calls f(size_t chunkIndex, std::span<T>) for each live chunk in order.
@@ -560,8 +709,8 @@ namespace entable {
             if (elemCount == 0) [[unlikely]] return;
             const size_t live = Helper::ChunkIndex(elemCount - 1) + 1;
             for (size_t c = 0; c + 1 < live; ++c)
-                f(c, std::span<T>(chunks[c].get(), CHUNK_SIZE));
-            f(live - 1, std::span<T>(chunks[live - 1].get(), elemCount - (live - 1) * CHUNK_SIZE));
+                f(c, std::span<T>(get_chunk_ptr(c), CHUNK_SIZE));
+            f(live - 1, std::span<T>(get_chunk_ptr(live - 1), elemCount - (live - 1) * CHUNK_SIZE));
         }
 
         template<typename F>
@@ -569,8 +718,8 @@ namespace entable {
             if (elemCount == 0) [[unlikely]] return;
             const size_t live = Helper::ChunkIndex(elemCount - 1) + 1;
             for (size_t c = 0; c + 1 < live; ++c)
-                f(c, std::span<const T>(chunks[c].get(), CHUNK_SIZE));
-            f(live - 1, std::span<const T>(chunks[live - 1].get(), elemCount - (live - 1) * CHUNK_SIZE));
+                f(c, std::span<const T>(get_chunk_ptr(c), CHUNK_SIZE));
+            f(live - 1, std::span<const T>(get_chunk_ptr(live - 1), elemCount - (live - 1) * CHUNK_SIZE));
         }
 
         iterator       begin()        { return iterator(this, 0); }
@@ -587,11 +736,13 @@ namespace entable {
 
         struct ChunkDeleter {
             void operator()(T* p) const noexcept {
-                ::operator delete(p, std::align_val_t{alignof(T)});
+                ::operator delete(p, std::align_val_t{chunk_alignment});
             }
         };
 
-        using ChunkPtr = std::unique_ptr<T, ChunkDeleter>;
+        using ChunkPtr = std::conditional_t<COPY_ON_WRITE, std::shared_ptr<T>, std::unique_ptr<T, ChunkDeleter>>;
+
+        struct NoHeadCapacity {};
 
         std::vector<ChunkPtr> chunks{};
         size_t elemCount{};
@@ -599,20 +750,90 @@ namespace entable {
         // Always consistent with elemCount; updated by update_write_ptr().
         T* m_writePtr{};
         T* m_chunkEnd{};
+        // Elements the first chunk can hold (GROW_FIRST_CHUNK only). Below
+        // CHUNK_SIZE only while it is the sole chunk.
+        [[no_unique_address]] std::conditional_t<GROW_FIRST_CHUNK, size_t, NoHeadCapacity> m_headCapacity{};
 
         // -----------------------------------------------------------------------
         // Private helpers
         // -----------------------------------------------------------------------
 
-        static ChunkPtr make_chunk() {
+        static ChunkPtr make_chunk(size_t capacity = CHUNK_SIZE) {
             T* raw = static_cast<T*>(
-                ::operator new(sizeof(T) * CHUNK_SIZE, std::align_val_t{alignof(T)}));
-            return ChunkPtr(raw);
+                ::operator new(sizeof(T) * capacity, std::align_val_t{chunk_alignment}));
+            return ChunkPtr(raw, ChunkDeleter{});
+        }
+
+        // Chunk chunk_idx for writing: in COPY_ON_WRITE mode a chunk shared
+        // with a fork is first replaced by a private copy of its live elements.
+        FORCE_INLINE T* writable_chunk(size_t chunk_idx) {
+            if constexpr (COPY_ON_WRITE) {
+                if (!owns_chunk(chunk_idx)) [[unlikely]]
+                    detach_chunk(chunk_idx);
+            }
+            return chunks[chunk_idx].get();
+        }
+
+        // Whether no fork references chunk chunk_idx any more. use_count() is
+        // a relaxed load; the acquire fence pairs with the release of the
+        // fork's reference, so that writing in place cannot race with the
+        // fork's last read of the chunk (e.g. its detach copy) on another thread.
+        [[nodiscard]] FORCE_INLINE bool owns_chunk(size_t chunk_idx) const noexcept requires COPY_ON_WRITE {
+            if (chunks[chunk_idx].use_count() > 1)
+                return false;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+
+        void detach_chunk(size_t chunk_idx) requires COPY_ON_WRITE {
+            const size_t capacity = chunk_idx == 0 ? head_capacity() : CHUNK_SIZE;
+            const size_t base     = chunk_idx * CHUNK_SIZE;
+            const size_t live     = elemCount > base ? std::min(capacity, elemCount - base) : 0;
+            ChunkPtr copy = make_chunk(capacity);
+            std::memcpy(static_cast<void*>(copy.get()), chunks[chunk_idx].get(), live * sizeof(T));
+            chunks[chunk_idx] = std::move(copy);
+            update_write_ptr();
+        }
+
+        [[nodiscard]] size_t head_capacity() const noexcept {
+            if constexpr (GROW_FIRST_CHUNK) return m_headCapacity;
+            else return CHUNK_SIZE;
+        }
+
+        // First-chunk capacity holding count elements: a power of two in
+        // [min_first_chunk, CHUNK_SIZE].
+        [[nodiscard]] static size_t first_chunk_step(size_t count) noexcept {
+            if (count >= CHUNK_SIZE) return CHUNK_SIZE;
+            return count <= min_first_chunk ? min_first_chunk : std::bit_ceil(count);
+        }
+
+        // Reallocates the first chunk to hold `capacity` elements, moving (or,
+        // for throwing moves, copying) the live ones over.
+        void resize_head(size_t capacity) requires GROW_FIRST_CHUNK {
+            ChunkPtr head = make_chunk(capacity);
+            if (chunks.empty()) {
+                chunks.push_back(std::move(head));
+            } else {
+                T* old = chunks[0].get();
+                const size_t live = std::min(elemCount, m_headCapacity);
+                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                    std::uninitialized_move(old, old + live, head.get());
+                else
+                    std::uninitialized_copy(old, old + live, head.get());
+                std::destroy(old, old + live);
+                chunks[0] = std::move(head);
+            }
+            m_headCapacity = capacity;
         }
 
         void allocate_chunks_for(size_t count) {
             if (count == 0) [[unlikely]] return;
             const size_t needed = Helper::ChunkIndex(count - 1) + 1;
+            if constexpr (GROW_FIRST_CHUNK) {
+                const size_t head = first_chunk_step(count);
+                if (chunks.empty() || m_headCapacity < head)
+                    resize_head(head);
+            }
             while (chunks.size() < needed)
                 chunks.push_back(make_chunk());
         }
@@ -637,7 +858,7 @@ namespace entable {
             const size_t first_chunk = Helper::ChunkIndex(old_count);
             const size_t last_chunk  = Helper::ChunkIndex(new_count - 1);
             for (size_t ci = first_chunk; ci <= last_chunk; ++ci) {
-                T*           base = chunks[ci].get();
+                T*           base = writable_chunk(ci);
                 const size_t lo   = (ci == first_chunk) ? Helper::OffsetIndex(old_count)     : 0;
                 const size_t hi   = (ci == last_chunk)  ? Helper::OffsetIndex(new_count - 1) + 1
                                                         : CHUNK_SIZE;
@@ -646,8 +867,59 @@ namespace entable {
             }
         }
 
+        // Appends count elements constructed chunk by chunk via fn (see
+        // construct_range); rolls back to the old size if fn throws.
+        template<typename ConstructFn>
+        void append_with(size_t count, ConstructFn&& fn) {
+            if (count == 0) return;
+            const size_t old_count = elemCount;
+            allocate_chunks_for(old_count + count);
+            try {
+                construct_range(old_count, old_count + count, fn);
+            } catch (...) {
+                truncate(old_count);
+                throw;
+            }
+        }
+
+        template<typename It>
+        void append_copy_n(It first, size_t count) {
+            using Source = std::iter_value_t<It>;
+            append_with(count, [&first](T* base, size_t lo, size_t hi) {
+                const size_t n = hi - lo;
+                if constexpr (std::contiguous_iterator<It> && std::is_same_v<std::remove_cv_t<Source>, T>
+                              && std::is_trivially_copyable_v<T>) {
+                    std::memcpy(static_cast<void*>(base + lo), std::to_address(first), n * sizeof(T));
+                    first += static_cast<std::iter_difference_t<It>>(n);
+                } else {
+                    first = std::ranges::uninitialized_copy_n(std::move(first), static_cast<std::iter_difference_t<It>>(n),
+                                                              base + lo, base + hi).in;
+                }
+            });
+        }
+
+        void truncate(size_t count) noexcept {
+            destroy_elements(count, elemCount);
+            elemCount = count;
+            update_write_ptr();
+        }
+
         void allocate_new_chunk() {
+            if constexpr (GROW_FIRST_CHUNK) {
+                if (elemCount < CHUNK_SIZE) {
+                    resize_head(first_chunk_step(elemCount + 1));
+                    update_write_ptr();
+                    return;
+                }
+            }
             const size_t next_chunk = Helper::ChunkIndex(elemCount);
+            if constexpr (COPY_ON_WRITE) {
+                // The write chunk exists but is shared (see update_write_ptr).
+                if (next_chunk < chunks.size()) {
+                    detach_chunk(next_chunk);
+                    return;
+                }
+            }
             if (next_chunk >= chunks.size()) [[unlikely]]
                 chunks.push_back(make_chunk());
             T* base = chunks[next_chunk].get();
@@ -690,10 +962,15 @@ namespace entable {
             }
             const size_t write_chunk = Helper::ChunkIndex(elemCount);
             const size_t write_off   = Helper::OffsetIndex(elemCount);
-            if (write_chunk < chunks.size()) [[likely]] {
+            // A shared write chunk is reported as full so that emplace_back
+            // detaches it in allocate_new_chunk.
+            bool writable = write_chunk < chunks.size();
+            if constexpr (COPY_ON_WRITE)
+                writable = writable && owns_chunk(write_chunk);
+            if (writable) [[likely]] {
                 T* base    = chunks[write_chunk].get();
                 m_writePtr = base + write_off;
-                m_chunkEnd = base + CHUNK_SIZE;
+                m_chunkEnd = base + (write_chunk == 0 ? head_capacity() : CHUNK_SIZE);
             } else {
                 m_writePtr = nullptr;
                 m_chunkEnd = nullptr;
@@ -701,4 +978,266 @@ namespace entable {
         }
     };
 
+
+    // -------------------------------------------------------------------------
+    // Segmented algorithms
+    //
+    // Counterparts of the <algorithm> functions that take a whole ChunkedArray
+    // and run the std:: algorithm once per contiguous chunk span, so the inner
+    // loops see plain pointers: no chunk-boundary branch per element and
+    // nothing stopping auto-vectorization. Results match the std:: versions
+    // over [begin(), end()) except for sort(), which is not stable either way.
+    // -------------------------------------------------------------------------
+
+    template <typename>
+    struct is_chunked_array : std::false_type {};
+
+    template <class T, size_t CHUNK_SIZE, size_t CHUNK_ALIGN, bool GROW_FIRST_CHUNK, bool COPY_ON_WRITE>
+    struct is_chunked_array<ChunkedArray<T, CHUNK_SIZE, CHUNK_ALIGN, GROW_FIRST_CHUNK, COPY_ON_WRITE>> : std::true_type {};
+
+    template <typename A>
+    concept chunked_array = is_chunked_array<std::remove_cvref_t<A>>::value;
+
+    // Calls fn(std::span<S>, std::span<D>) over [0, count) of src and dst in
+    // runs that lie within one chunk of each, for arrays of any chunk sizes.
+    template <chunked_array Src, chunked_array Dst, typename Fn>
+    void for_each_segment_pair(Src& src, Dst& dst, size_t count, Fn&& fn) {
+        assert(count <= src.size() && count <= dst.size());
+        size_t si = 0, di = 0;
+        for (size_t done = 0; done < count;) {
+            auto s = src.get_chunk_span(si);
+            auto d = dst.get_chunk_span(di);
+            const size_t s_off = done - si * std::remove_cvref_t<Src>::chunk_size;
+            const size_t d_off = done - di * std::remove_cvref_t<Dst>::chunk_size;
+            const size_t n = std::min({ s.size() - s_off, d.size() - d_off, count - done });
+            fn(s.subspan(s_off, n), d.subspan(d_off, n));
+            done += n;
+            if (s_off + n == s.size()) ++si;
+            if (d_off + n == d.size()) ++di;
+        }
+    }
+
+    template <chunked_array A, typename U>
+    void fill(A& arr, const U& value) {
+        arr.for_each_chunk([&value](auto chunk) { std::fill(chunk.begin(), chunk.end(), value); });
+    }
+
+    // Copies src to out; returns the end of the output range.
+    template <chunked_array A, std::weakly_incrementable OutIt>
+        requires (!chunked_array<OutIt>)
+    OutIt copy(const A& src, OutIt out) {
+        src.for_each_chunk([&out](auto chunk) { out = std::copy(chunk.begin(), chunk.end(), out); });
+        return out;
+    }
+
+    // Overwrites the first src.size() elements of dst (which must be at least
+    // as long), chunk span against chunk span.
+    template <chunked_array A, chunked_array B>
+    void copy(const A& src, B& dst) {
+        for_each_segment_pair(src, dst, src.size(), [](auto s, auto d) { std::copy(s.begin(), s.end(), d.begin()); });
+    }
+
+    template <chunked_array A, std::weakly_incrementable OutIt, typename Op>
+        requires (!chunked_array<OutIt>)
+    OutIt transform(const A& src, OutIt out, Op op) {
+        src.for_each_chunk([&out, &op](auto chunk) { out = std::transform(chunk.begin(), chunk.end(), out, op); });
+        return out;
+    }
+
+    // dst[i] = op(src[i]) for i < src.size(); dst may be src itself.
+    template <chunked_array A, chunked_array B, typename Op>
+    void transform(const A& src, B& dst, Op op) {
+        if (static_cast<const void*>(&src) == static_cast<const void*>(&dst)) {
+            dst.for_each_chunk([&op](auto chunk) { std::transform(chunk.begin(), chunk.end(), chunk.begin(), op); });
+            return;
+        }
+        for_each_segment_pair(src, dst, src.size(), [&op](auto s, auto d) { std::transform(s.begin(), s.end(), d.begin(), op); });
+    }
+
+    // Iterator to the first element equal to value, or end().
+    template <chunked_array A, typename U>
+    auto find(A& arr, const U& value) {
+        size_t chunk_base = 0;
+        size_t found = arr.size();
+        const auto& carr = arr;
+        for (size_t c = 0; chunk_base < carr.size(); ++c) {
+            const auto chunk = carr.get_chunk_span(c);
+            const auto it = std::find(chunk.begin(), chunk.end(), value);
+            if (it != chunk.end()) {
+                found = chunk_base + static_cast<size_t>(it - chunk.begin());
+                break;
+            }
+            chunk_base += chunk.size();
+        }
+        return arr.begin() + static_cast<std::ptrdiff_t>(found);
+    }
+
+    template <chunked_array A, typename Pred>
+    [[nodiscard]] size_t count_if(const A& arr, Pred pred) {
+        size_t n = 0;
+        arr.for_each_chunk([&n, &pred](auto chunk) {
+            n += static_cast<size_t>(std::count_if(chunk.begin(), chunk.end(), pred));
+        });
+        return n;
+    }
+
+    // Sorts each chunk with std::sort, then k-way merges the sorted chunks
+    // through a heap of chunk cursors into a scratch buffer of size() elements
+    // and moves the result back. O(n log n) comparisons, no comparison across
+    // chunks until the merge.
+    template <chunked_array A, typename Compare = std::less<>>
+    void sort(A& arr, Compare comp = {}) {
+        using T = typename std::remove_cvref_t<A>::value_type;
+        std::vector<std::span<T>> runs;
+        arr.for_each_chunk([&runs, &comp](std::span<T> chunk) {
+            std::sort(chunk.begin(), chunk.end(), comp);
+            runs.push_back(chunk);
+        });
+        if (runs.size() < 2) return;
+
+        // Heap of (run, position) cursors ordered by their current element.
+        struct Cursor { T* pos; T* end; };
+        std::vector<Cursor> heap;
+        heap.reserve(runs.size());
+        for (auto run : runs)
+            heap.push_back({ run.data(), run.data() + run.size() });
+        const auto later = [&comp](const Cursor& a, const Cursor& b) { return comp(*b.pos, *a.pos); };
+        std::make_heap(heap.begin(), heap.end(), later);
+
+        std::vector<T> merged;
+        merged.reserve(arr.size());
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            Cursor& top = heap.back();
+            merged.push_back(std::move(*top.pos));
+            if (++top.pos == top.end) heap.pop_back();
+            else std::push_heap(heap.begin(), heap.end(), later);
+        }
+
+        auto from = merged.begin();
+        for (auto run : runs) {
+            std::move(from, from + static_cast<std::ptrdiff_t>(run.size()), run.begin());
+            from += static_cast<std::ptrdiff_t>(run.size());
+        }
+    }
+
+
+    // -------------------------------------------------------------------------
+    // Binary search on sorted ChunkedArrays
+    //
+    // std::lower_bound over iterators reloads a chunk pointer at every probe,
+    // and the early probes each land on a cold cache line of another chunk.
+    // These search the chunks' first keys, then one contiguous chunk. The
+    // first keys come from a ChunkKeyIndex, a compact array that stays in
+    // cache across searches, or are read through the chunk pointers if no
+    // index is given. Same results, comparator and projection conventions as
+    // std::ranges::lower_bound / upper_bound / equal_range.
+    // -------------------------------------------------------------------------
+
+    // Number of leading indices in [0, n) satisfying pred, for pred true on a
+    // prefix. Branch-free halving: the probe sequence does not depend on the
+    // outcomes, so there are no mispredictions to pay for.
+    template <typename Pred>
+    [[nodiscard]] size_t branchless_partition_point(size_t n, Pred pred) {
+        if (n == 0) return 0;
+        size_t base = 0;
+        while (n > 1) {
+            const size_t half = n / 2;
+            base = pred(base + half) ? base + half : base;
+            n -= half;
+        }
+        return base + (pred(base) ? 1 : 0);
+    }
+
+    // Projected first key of each chunk of a sorted ChunkedArray. Rebuild it
+    // after the array is modified; O(chunk count).
+    template <class Key>
+    class ChunkKeyIndex
+    {
+    public:
+        ChunkKeyIndex() = default;
+
+        template <chunked_array A, typename Proj = std::identity>
+        explicit ChunkKeyIndex(const A& arr, Proj proj = {}) { rebuild(arr, proj); }
+
+        template <chunked_array A, typename Proj = std::identity>
+        void rebuild(const A& arr, Proj proj = {}) {
+            keys.clear();
+            arr.for_each_chunk([this, &proj](auto chunk) { keys.push_back(std::invoke(proj, chunk.front())); });
+        }
+
+        [[nodiscard]] std::span<const Key> first_keys() const noexcept { return keys; }
+        [[nodiscard]] size_t size() const noexcept { return keys.size(); }
+
+    private:
+        std::vector<Key> keys;
+    };
+
+    // Index of the first element for which below(element) is false, given a
+    // test below_first(c) of the first key of chunk c consistent with it.
+    template <chunked_array A, typename ChunkBelow, typename Below>
+    [[nodiscard]] size_t chunked_partition_point(const A& arr, ChunkBelow below_first, Below below) {
+        constexpr size_t chunk_size = std::remove_cvref_t<A>::chunk_size;
+        if (arr.empty()) return 0;
+        const size_t live = (arr.size() - 1) / chunk_size + 1;
+        // Chunks starting below the key; the partition point is in the last of them.
+        const size_t c = branchless_partition_point(live, below_first);
+        if (c == 0) return 0;
+        const auto chunk = arr.get_chunk_span(c - 1);
+        const size_t n = chunk.size();
+        // Its first element is below the key, so only [1, n) needs searching.
+        return (c - 1) * chunk_size + 1 + branchless_partition_point(n - 1,
+            [&chunk, &below](size_t i) { return below(chunk[i + 1]); });
+    }
+
+    template <chunked_array A, typename U, typename Compare = std::ranges::less, typename Proj = std::identity>
+    [[nodiscard]] auto lower_bound(A& arr, const U& value, Compare comp = {}, Proj proj = {}) {
+        const auto& carr = arr;
+        const auto below = [&](const auto& e) { return std::invoke(comp, std::invoke(proj, e), value); };
+        const size_t idx = chunked_partition_point(carr,
+            [&](size_t c) { return below(carr.get_chunk_ptr(c)[0]); }, below);
+        return arr.begin() + static_cast<std::ptrdiff_t>(idx);
+    }
+
+    template <chunked_array A, typename U, typename Compare = std::ranges::less, typename Proj = std::identity>
+    [[nodiscard]] auto upper_bound(A& arr, const U& value, Compare comp = {}, Proj proj = {}) {
+        const auto& carr = arr;
+        const auto not_above = [&](const auto& e) { return !std::invoke(comp, value, std::invoke(proj, e)); };
+        const size_t idx = chunked_partition_point(carr,
+            [&](size_t c) { return not_above(carr.get_chunk_ptr(c)[0]); }, not_above);
+        return arr.begin() + static_cast<std::ptrdiff_t>(idx);
+    }
+
+    // index must have been built from arr as it is now, with the same projection.
+    template <chunked_array A, class Key, typename U, typename Compare = std::ranges::less, typename Proj = std::identity>
+    [[nodiscard]] auto lower_bound(A& arr, const ChunkKeyIndex<Key>& index, const U& value, Compare comp = {}, Proj proj = {}) {
+        const auto keys = index.first_keys();
+        assert(keys.size() == (arr.empty() ? 0 : (arr.size() - 1) / std::remove_cvref_t<A>::chunk_size + 1));
+        const size_t idx = chunked_partition_point(std::as_const(arr),
+            [&](size_t c) { return std::invoke(comp, keys[c], value); },
+            [&](const auto& e) { return std::invoke(comp, std::invoke(proj, e), value); });
+        return arr.begin() + static_cast<std::ptrdiff_t>(idx);
+    }
+
+    template <chunked_array A, class Key, typename U, typename Compare = std::ranges::less, typename Proj = std::identity>
+    [[nodiscard]] auto upper_bound(A& arr, const ChunkKeyIndex<Key>& index, const U& value, Compare comp = {}, Proj proj = {}) {
+        const auto keys = index.first_keys();
+        assert(keys.size() == (arr.empty() ? 0 : (arr.size() - 1) / std::remove_cvref_t<A>::chunk_size + 1));
+        const size_t idx = chunked_partition_point(std::as_const(arr),
+            [&](size_t c) { return !std::invoke(comp, value, keys[c]); },
+            [&](const auto& e) { return !std::invoke(comp, value, std::invoke(proj, e)); });
+        return arr.begin() + static_cast<std::ptrdiff_t>(idx);
+    }
+
+    // [lower_bound, upper_bound) as a pair of iterators.
+    template <chunked_array A, typename U, typename Compare = std::ranges::less, typename Proj = std::identity>
+    [[nodiscard]] auto equal_range(A& arr, const U& value, Compare comp = {}, Proj proj = {}) {
+        return std::pair(entable::lower_bound(arr, value, comp, proj), entable::upper_bound(arr, value, comp, proj));
+    }
+
+    template <chunked_array A, class Key, typename U, typename Compare = std::ranges::less, typename Proj = std::identity>
+    [[nodiscard]] auto equal_range(A& arr, const ChunkKeyIndex<Key>& index, const U& value, Compare comp = {}, Proj proj = {}) {
+        return std::pair(entable::lower_bound(arr, index, value, comp, proj), entable::upper_bound(arr, index, value, comp, proj));
+    }
+
 } // namespace entable
@@ -0,0 +1,399 @@
+#pragma once
+
+#include "ChunkedArray.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace entable {
+
+    // FIFO queue on ChunkedArray-style chunks: push_back at the tail,
+    // pop_front at the head, both O(1).
+    //
+    // Chunk pointers live in a power-of-two ring; the live chunks are a
+    // contiguous (wrapping) run of it. When the head leaves a chunk, that
+    // chunk stays in its ring slot, which is now the slot right after the
+    // tail's run, so the tail reuses it when it next crosses a boundary; a
+    // spare chunk in another idle slot is moved over before a new one is
+    // allocated. Once the queue has reached its high-water mark, push_back /
+    // pop_front never allocate. shrink_to_fit() releases the chunks not
+    // holding elements.
+    //
+    // As in ChunkedArray, elements never move: pointers and references stay
+    // valid until the element is popped. Chunks start on a CHUNK_ALIGN
+    // boundary and for_each_chunk visits the live elements as contiguous
+    // spans, the first one starting at the head.
+    template <class T, size_t CHUNK_SIZE = 128, size_t CHUNK_ALIGN = DEFAULT_CHUNK_ALIGN>
+    class ChunkedQueue
+    {
+        static_assert(std::has_single_bit(CHUNK_ALIGN) && CHUNK_ALIGN <= 4096,
+            "CHUNK_ALIGN must be a power of two no larger than 4096");
+
+        using Helper = ChunkHelper<CHUNK_SIZE>;
+
+    public:
+        using value_type      = T;
+        using size_type       = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = const T&;
+        using pointer         = T*;
+        using const_pointer   = const T*;
+
+        static constexpr size_t chunk_size      = CHUNK_SIZE;
+        static constexpr size_t chunk_alignment = CHUNK_ALIGN > alignof(T) ? CHUNK_ALIGN : alignof(T);
+
+        // Random-access iterator over the queue from front to back.
+        // Invalidated by pop_front of the element it refers to; push_back
+        // does not invalidate it.
+        template <bool IS_CONST>
+        class Iterator
+        {
+            using Queue = std::conditional_t<IS_CONST, const ChunkedQueue, ChunkedQueue>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using iterator_concept  = std::random_access_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = std::conditional_t<IS_CONST, const T*, T*>;
+            using reference         = std::conditional_t<IS_CONST, const T&, T&>;
+
+            Iterator() noexcept = default;
+            Iterator(Queue* q, size_t idx) noexcept : queue(q), index(idx) {}
+            // iterator -> const_iterator
+            template <bool OTHER_CONST> requires (IS_CONST && !OTHER_CONST)
+            Iterator(const Iterator<OTHER_CONST>& other) noexcept : queue(other.queue), index(other.index) {}
+
+            reference operator*() const noexcept { return (*queue)[index]; }
+            pointer operator->() const noexcept { return &(*queue)[index]; }
+            reference operator[](difference_type n) const noexcept { return (*queue)[index + n]; }
+
+            Iterator& operator++() noexcept { ++index; return *this; }
+            Iterator  operator++(int) noexcept { Iterator t = *this; ++index; return t; }
+            Iterator& operator--() noexcept { --index; return *this; }
+            Iterator  operator--(int) noexcept { Iterator t = *this; --index; return t; }
+            Iterator& operator+=(difference_type n) noexcept { index += n; return *this; }
+            Iterator& operator-=(difference_type n) noexcept { index -= n; return *this; }
+
+            friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+            friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+            friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+            friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept {
+                return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+            }
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.index == b.index; }
+            friend auto operator<=>(const Iterator& a, const Iterator& b) noexcept { return a.index <=> b.index; }
+
+        private:
+            template <bool> friend class Iterator;
+
+            Queue* queue{};
+            size_t index{};
+        };
+
+        using iterator       = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        // -----------------------------------------------------------------------
+        // Construction / destruction
+        // -----------------------------------------------------------------------
+
+        ChunkedQueue() = default;
+
+        ~ChunkedQueue() {
+            destroy_front(elemCount);
+        }
+
+        ChunkedQueue(const ChunkedQueue&)            = delete;
+        ChunkedQueue& operator=(const ChunkedQueue&) = delete;
+
+        ChunkedQueue(ChunkedQueue&& other) noexcept
+            : ring(std::move(other.ring))
+            , firstSlot(std::exchange(other.firstSlot, 0))
+            , headOffset(std::exchange(other.headOffset, 0))
+            , elemCount(std::exchange(other.elemCount, 0))
+            , allocatedChunks(std::exchange(other.allocatedChunks, 0))
+            , m_readPtr(std::exchange(other.m_readPtr, nullptr))
+            , m_writePtr(std::exchange(other.m_writePtr, nullptr))
+            , m_chunkEnd(std::exchange(other.m_chunkEnd, nullptr))
+        {}
+
+        ChunkedQueue& operator=(ChunkedQueue&& other) noexcept {
+            if (this != &other) {
+                destroy_front(elemCount);
+                ring       = std::move(other.ring);
+                firstSlot  = std::exchange(other.firstSlot, 0);
+                headOffset = std::exchange(other.headOffset, 0);
+                elemCount  = std::exchange(other.elemCount, 0);
+                allocatedChunks = std::exchange(other.allocatedChunks, 0);
+                m_readPtr  = std::exchange(other.m_readPtr, nullptr);
+                m_writePtr = std::exchange(other.m_writePtr, nullptr);
+                m_chunkEnd = std::exchange(other.m_chunkEnd, nullptr);
+            }
+            return *this;
+        }
+
+        // Explicit deep copy of the elements, front to back.
+        [[nodiscard]] ChunkedQueue clone() const {
+            ChunkedQueue copy;
+            for_each_chunk([&copy](std::span<const T> chunk) {
+                for (const T& value : chunk)
+                    copy.push_back(value);
+            });
+            return copy;
+        }
+
+        // -----------------------------------------------------------------------
+        // Element access
+        // -----------------------------------------------------------------------
+
+        // idx counts from the front.
+        T& operator[](size_t idx) noexcept {
+            assert(idx < elemCount);
+            const size_t pos = headOffset + idx;
+            return chunk_at(Helper::ChunkIndex(pos))[Helper::OffsetIndex(pos)];
+        }
+
+        const T& operator[](size_t idx) const noexcept {
+            assert(idx < elemCount);
+            const size_t pos = headOffset + idx;
+            return chunk_at(Helper::ChunkIndex(pos))[Helper::OffsetIndex(pos)];
+        }
+
+        T&       front()       noexcept { assert(elemCount > 0); return *m_readPtr; }
+        const T& front() const noexcept { assert(elemCount > 0); return *m_readPtr; }
+        T&       back()        noexcept { assert(elemCount > 0); return m_writePtr[-1]; }
+        const T& back()  const noexcept { assert(elemCount > 0); return m_writePtr[-1]; }
+
+        iterator       begin()        noexcept { return iterator(this, 0); }
+        iterator       end()          noexcept { return iterator(this, elemCount); }
+        const_iterator begin()  const noexcept { return const_iterator(this, 0); }
+        const_iterator end()    const noexcept { return const_iterator(this, elemCount); }
+        const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+        const_iterator cend()   const noexcept { return const_iterator(this, elemCount); }
+
+        // Calls f(std::span<T>) for each live chunk from front to back.
+        template<typename F>
+        void for_each_chunk(F&& f) {
+            visit_chunks([&f](T* p, size_t n) { f(std::span<T>(p, n)); });
+        }
+
+        template<typename F>
+        void for_each_chunk(F&& f) const {
+            visit_chunks([&f](T* p, size_t n) { f(std::span<const T>(p, n)); });
+        }
+
+        // -----------------------------------------------------------------------
+        // Capacity
+        // -----------------------------------------------------------------------
+
+        [[nodiscard]] bool   empty() const noexcept { return elemCount == 0; }
+        [[nodiscard]] size_t size()  const noexcept { return elemCount; }
+
+        // Allocated chunks, live or waiting for reuse.
+        [[nodiscard]] size_t chunk_count() const noexcept { return allocatedChunks; }
+
+        [[nodiscard]] ChunkedArrayStats memory_stats() const noexcept {
+            ChunkedArrayStats stats;
+            stats.chunk_count      = chunk_count();
+            stats.allocated_bytes  = stats.chunk_count * CHUNK_SIZE * sizeof(T);
+            stats.live_bytes       = elemCount * sizeof(T);
+            stats.live_chunk_count = live_chunk_count();
+            stats.index_bytes      = ring.capacity() * sizeof(ChunkPtr);
+            return stats;
+        }
+
+        // Frees the chunks not holding elements and shrinks the ring to the
+        // live chunks.
+        void shrink_to_fit() {
+            const size_t live = live_chunk_count();
+            std::vector<ChunkPtr> shrunk(live > 0 ? std::bit_ceil(live) : 0);
+            for (size_t c = 0; c < live; ++c)
+                shrunk[c] = std::move(ring[slot_of(c)]);
+            ring = std::move(shrunk);
+            firstSlot = 0;
+            allocatedChunks = live;
+            if (live == 0) {
+                headOffset = 0;
+                m_readPtr = m_writePtr = m_chunkEnd = nullptr;
+            }
+        }
+
+        // -----------------------------------------------------------------------
+        // Modifiers
+        // -----------------------------------------------------------------------
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value)      { emplace_back(std::move(value)); }
+
+        template<typename... Args>
+        FORCE_INLINE T& emplace_back(Args&&... args) {
+            if (m_writePtr == m_chunkEnd) [[unlikely]]
+                open_tail_chunk();
+            T* slot = ::new (static_cast<void*>(m_writePtr)) T(std::forward<Args>(args)...);
+            ++m_writePtr;
+            ++elemCount;
+            return *slot;
+        }
+
+        // When the head leaves a chunk, the chunk is kept for the tail.
+        FORCE_INLINE void pop_front() noexcept {
+            assert(elemCount > 0);
+            std::destroy_at(m_readPtr);
+            ++m_readPtr;
+            --elemCount;
+            if (++headOffset == CHUNK_SIZE || elemCount == 0) [[unlikely]]
+                advance_head();
+        }
+
+        // Pops the n front elements, skipping whole chunks at once.
+        void pop_front(size_t n) noexcept {
+            assert(n <= elemCount);
+            destroy_front(n);
+            elemCount -= n;
+            if (elemCount == 0) {
+                rewind();
+                return;
+            }
+            const size_t pos = headOffset + n;
+            firstSlot  = (firstSlot + Helper::ChunkIndex(pos)) & ring_mask();
+            headOffset = Helper::OffsetIndex(pos);
+            m_readPtr  = chunk_at(0) + headOffset;
+        }
+
+        // Destroys all elements; chunks are kept for reuse.
+        void clear() noexcept {
+            destroy_front(elemCount);
+            elemCount = 0;
+            rewind();
+        }
+
+    private:
+        struct ChunkDeleter {
+            void operator()(T* p) const noexcept {
+                ::operator delete(p, std::align_val_t{chunk_alignment});
+            }
+        };
+
+        using ChunkPtr = std::unique_ptr<T, ChunkDeleter>;
+
+        // Power-of-two sized; slot firstSlot holds the front chunk.
+        std::vector<ChunkPtr> ring{};
+        size_t firstSlot{};
+        // Index of the front element within the front chunk.
+        size_t headOffset{};
+        size_t elemCount{};
+        // Non-null ring slots.
+        size_t allocatedChunks{};
+        // Cached front element, chunk_at(0) + headOffset.
+        T* m_readPtr{};
+        // Cached write position; m_writePtr == m_chunkEnd when the tail
+        // chunk is full (or none is open yet).
+        T* m_writePtr{};
+        T* m_chunkEnd{};
+
+        static constexpr size_t min_ring_size = 8;
+
+        size_t ring_mask() const noexcept { return ring.size() - 1; }
+        size_t slot_of(size_t chunk) const noexcept { return (firstSlot + chunk) & ring_mask(); }
+        T* chunk_at(size_t chunk) const noexcept { return ring[slot_of(chunk)].get(); }
+
+        size_t live_chunk_count() const noexcept {
+            return elemCount > 0 ? Helper::ChunkIndex(headOffset + elemCount - 1) + 1 : 0;
+        }
+
+        template<typename F>
+        void visit_chunks(F&& f) const {
+            size_t remaining = elemCount;
+            size_t offset = headOffset;
+            for (size_t c = 0; remaining > 0; ++c) {
+                const size_t n = std::min(CHUNK_SIZE - offset, remaining);
+                f(chunk_at(c) + offset, n);
+                remaining -= n;
+                offset = 0;
+            }
+        }
+
+        // Opens the chunk after the tail: the one recycled in its slot, else
+        // a spare from another idle slot, else a new one. The ring doubles
+        // when every slot is live.
+        void open_tail_chunk() {
+            // Chunks in use once the new element is in, counting the one it goes to.
+            const size_t needed = Helper::ChunkIndex(headOffset + elemCount) + 1;
+            if (needed > ring.size())
+                grow_ring();
+            ChunkPtr& chunk = ring[slot_of(needed - 1)];
+            if (chunk == nullptr) {
+                if (allocatedChunks > needed - 1) {
+                    // Idle slots right behind the head are the likeliest to hold one.
+                    for (size_t c = ring.size() - 1; chunk == nullptr; --c)
+                        chunk = std::move(ring[slot_of(c)]);
+                } else {
+                    chunk.reset(static_cast<T*>(
+                        ::operator new(sizeof(T) * CHUNK_SIZE, std::align_val_t{chunk_alignment})));
+                    ++allocatedChunks;
+                }
+            }
+            m_writePtr = chunk.get();
+            m_chunkEnd = m_writePtr + CHUNK_SIZE;
+            if (elemCount == 0)
+                m_readPtr = m_writePtr;
+        }
+
+        // Doubles the ring, unwrapping the chunks so the front one is in slot 0.
+        void grow_ring() {
+            std::vector<ChunkPtr> grown(std::max(min_ring_size, ring.size() * 2));
+            for (size_t c = 0; c < ring.size(); ++c)
+                grown[c] = std::move(ring[slot_of(c)]);
+            ring = std::move(grown);
+            firstSlot = 0;
+        }
+
+        // pop_front slow path: the head left its chunk or the queue is empty.
+        void advance_head() noexcept {
+            if (elemCount == 0) {
+                rewind();
+                return;
+            }
+            headOffset = 0;
+            firstSlot  = (firstSlot + 1) & ring_mask();
+            m_readPtr  = ring[firstSlot].get();
+        }
+
+        // Empty queue: restart at the front chunk so that it is reused
+        // instead of the head walking on to the next one.
+        void rewind() noexcept {
+            headOffset = 0;
+            if (ring.empty() || ring[firstSlot] == nullptr) {
+                m_readPtr = m_writePtr = m_chunkEnd = nullptr;
+                return;
+            }
+            m_readPtr = m_writePtr = ring[firstSlot].get();
+            m_chunkEnd = m_writePtr + CHUNK_SIZE;
+        }
+
+        void destroy_front(size_t n) noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                size_t offset = headOffset;
+                for (size_t c = 0; n > 0; ++c) {
+                    const size_t k = std::min(CHUNK_SIZE - offset, n);
+                    std::destroy_n(chunk_at(c) + offset, k);
+                    n -= k;
+                    offset = 0;
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+#include "ChunkedArray.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace entable {
+
+    // Default number of chunk slots preallocated by a ConcurrentChunkedArray.
+    static constexpr size_t DEFAULT_CONCURRENT_MAX_CHUNKS = 4096;
+
+
+    // Append-only chunked array that many threads fill at once without a lock.
+    //
+    // Meant for per-frame event logs, spawn requests, collision pairs and
+    // similar outputs of parallel systems:
+    //   - An append claims its index range with one atomic fetch_add.
+    //   - Chunks live in a table of atomic pointers preallocated by the
+    //     constructor; the first thread to need a chunk allocates it and
+    //     installs it with a CAS, a thread losing the race frees its copy.
+    //     The table never moves, so elements never move either.
+    //   - size() is the published size: elements [0, size()) are fully
+    //     constructed and visible to the reading thread, so readers may run
+    //     concurrently with producers. A finished append marks its range as
+    //     ready in a per-chunk side table, then whichever producer finds
+    //     ready ranges at the published size moves it past them with a CAS.
+    //     Nobody waits for a slower or preempted producer; its range, and
+    //     the ones after it, become visible once it finishes.
+    //
+    // Only the appends, reserve() and the const readers are thread safe;
+    // clear(), reset() and mutable element access must not overlap any other
+    // call, typically they run between frames.
+    //
+    // The capacity, max_chunks * CHUNK_SIZE elements, is fixed at
+    // construction. An append that does not fit throws std::length_error and
+    // every later append throws as well until clear(); elements published
+    // before it stay valid.
+    //
+    // Appends are noexcept once the range is claimed: a throwing constructor
+    // or a failed chunk allocation calls std::terminate, as the claimed slots
+    // could never be published.
+    template <class T, size_t CHUNK_SIZE = 1024, size_t CHUNK_ALIGN = DEFAULT_CHUNK_ALIGN>
+    class ConcurrentChunkedArray
+    {
+        static_assert(std::has_single_bit(CHUNK_ALIGN) && CHUNK_ALIGN <= 4096,
+            "CHUNK_ALIGN must be a power of two no larger than 4096");
+        static_assert(CHUNK_SIZE <= (size_t{1} << 31), "ready run lengths are stored as 32 bits");
+
+        using Helper = ChunkHelper<CHUNK_SIZE>;
+        using ReadyRun = std::atomic<uint32_t>;
+
+    public:
+        using value_type      = T;
+        using size_type       = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = const T&;
+
+        static constexpr size_t chunk_size      = CHUNK_SIZE;
+        static constexpr size_t chunk_alignment = CHUNK_ALIGN > alignof(T) ? CHUNK_ALIGN : alignof(T);
+
+        explicit ConcurrentChunkedArray(size_t max_chunks = DEFAULT_CONCURRENT_MAX_CHUNKS)
+            : m_table(std::make_unique<std::atomic<T*>[]>(max_chunks))
+            , m_maxChunks(max_chunks)
+        {}
+
+        ~ConcurrentChunkedArray() { reset(); }
+
+        ConcurrentChunkedArray(const ConcurrentChunkedArray&)            = delete;
+        ConcurrentChunkedArray& operator=(const ConcurrentChunkedArray&) = delete;
+
+        // -----------------------------------------------------------------------
+        // Concurrent appends
+        // -----------------------------------------------------------------------
+
+        // Returns the index of the new element.
+        template<typename... Args>
+        size_t emplace_back(Args&&... args) {
+            const size_t idx = claim(1);
+            construct_and_publish(idx, std::forward<Args>(args)...);
+            return idx;
+        }
+
+        size_t push_back(const T& value) { return emplace_back(value); }
+        size_t push_back(T&& value)      { return emplace_back(std::move(value)); }
+
+        // Appends a sized range as one contiguous block, paying a single
+        // fetch_add and a single publication for all of it. Returns the index
+        // of the first element.
+        template <std::ranges::sized_range R>
+        size_t append_range(R&& range) {
+            const size_t count = static_cast<size_t>(std::ranges::size(range));
+            const size_t first = claim(count);
+            copy_and_publish(first, std::ranges::begin(range), count);
+            return first;
+        }
+
+        // Installs the chunks for the first n elements so that the appends
+        // filling them skip allocation.
+        void reserve(size_t n) {
+            if (n > capacity()) throw std::length_error("ConcurrentChunkedArray: capacity exceeded");
+            const size_t chunkCount = (n + CHUNK_SIZE - 1) / CHUNK_SIZE;
+            for (size_t ci = 0; ci < chunkCount; ++ci)
+                install_chunk(ci);
+        }
+
+        // -----------------------------------------------------------------------
+        // Readers
+        // -----------------------------------------------------------------------
+
+        // Published element count.
+        [[nodiscard]] size_t size() const noexcept { return m_published.load(std::memory_order_acquire); }
+        [[nodiscard]] bool   empty() const noexcept { return size() == 0; }
+        [[nodiscard]] size_t capacity() const noexcept { return m_maxChunks * CHUNK_SIZE; }
+        [[nodiscard]] size_t max_chunks() const noexcept { return m_maxChunks; }
+
+        // Requires idx < size() as observed by the calling thread.
+        const T& operator[](size_t idx) const noexcept {
+            assert(idx < size());
+            return chunk_at(Helper::ChunkIndex(idx))[Helper::OffsetIndex(idx)];
+        }
+
+        // Not thread safe: for post-processing once the producers are done.
+        T& operator[](size_t idx) noexcept {
+            assert(idx < size());
+            return chunk_at(Helper::ChunkIndex(idx))[Helper::OffsetIndex(idx)];
+        }
+
+        // Calls fn(std::span<const T>) for each chunk of the elements published
+        // when the call starts.
+        template <class Fn>
+        void for_each_chunk(Fn&& fn) const {
+            const size_t count = size();
+            for (size_t base = 0; base < count; base += CHUNK_SIZE) {
+                const size_t len = std::min(CHUNK_SIZE, count - base);
+                fn(std::span<const T>(chunk_at(Helper::ChunkIndex(base)), len));
+            }
+        }
+
+        // Calls fn(const T&) for each element published when the call starts.
+        template <class Fn>
+        void for_each(Fn&& fn) const {
+            for_each_chunk([&](std::span<const T> chunk) {
+                for (const T& value : chunk)
+                    fn(value);
+            });
+        }
+
+        // Installed chunks, whether holding elements or not.
+        [[nodiscard]] size_t chunk_count() const noexcept {
+            size_t n = 0;
+            for (size_t ci = 0; ci < m_maxChunks; ++ci)
+                n += m_table[ci].load(std::memory_order_relaxed) != nullptr;
+            return n;
+        }
+
+        // -----------------------------------------------------------------------
+        // Single-threaded maintenance
+        // -----------------------------------------------------------------------
+
+        // Destroys all elements and keeps the chunks for the next fill.
+        void clear() noexcept {
+            const size_t count = m_published.load(std::memory_order_relaxed);
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < count; ++i)
+                    std::destroy_at(&(*this)[i]);
+            }
+            m_published.store(0, std::memory_order_relaxed);
+            m_claimed.store(0, std::memory_order_relaxed);
+        }
+
+        // Destroys all elements and frees every chunk.
+        void reset() noexcept {
+            clear();
+            for (size_t ci = 0; ci < m_maxChunks; ++ci) {
+                if (T* p = m_table[ci].exchange(nullptr, std::memory_order_relaxed))
+                    free_chunk(p);
+            }
+        }
+
+    private:
+        std::unique_ptr<std::atomic<T*>[]> m_table;
+        size_t m_maxChunks;
+        // Claimed and published element counts on separate cache lines:
+        // producers hammer the first, readers poll the second.
+        alignas(64) std::atomic<size_t> m_claimed{0};
+        alignas(64) std::atomic<size_t> m_published{0};
+
+        // A chunk holds CHUNK_SIZE element slots followed by one ReadyRun per
+        // slot: non-zero at the first slot of a constructed, unpublished run
+        // of that many elements.
+        static constexpr size_t ready_offset =
+            (sizeof(T) * CHUNK_SIZE + alignof(ReadyRun) - 1) / alignof(ReadyRun) * alignof(ReadyRun);
+        static constexpr size_t chunk_bytes = ready_offset + sizeof(ReadyRun) * CHUNK_SIZE;
+
+        static ReadyRun* ready_runs(T* chunk) noexcept {
+            return std::launder(reinterpret_cast<ReadyRun*>(reinterpret_cast<std::byte*>(chunk) + ready_offset));
+        }
+
+        static T* allocate_chunk() {
+            void* raw = ::operator new(chunk_bytes, std::align_val_t{chunk_alignment});
+            std::uninitialized_value_construct_n(
+                reinterpret_cast<ReadyRun*>(static_cast<std::byte*>(raw) + ready_offset), CHUNK_SIZE);
+            return static_cast<T*>(raw);
+        }
+
+        static void free_chunk(T* p) noexcept {
+            ::operator delete(p, std::align_val_t{chunk_alignment});
+        }
+
+        T* chunk_at(size_t ci) const noexcept {
+            return m_table[ci].load(std::memory_order_acquire);
+        }
+
+        // Returns chunk ci, allocating and installing it if nobody has yet.
+        T* install_chunk(size_t ci) {
+            T* chunk = m_table[ci].load(std::memory_order_acquire);
+            if (chunk != nullptr) [[likely]]
+                return chunk;
+            T* fresh = allocate_chunk();
+            if (m_table[ci].compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+                return fresh;
+            free_chunk(fresh);
+            return chunk;
+        }
+
+        // Reserves [first, first + count); throws when it does not fit. The
+        // counter is bumped even then, so that every later claim fails too
+        // instead of landing behind the slots that will never be published.
+        size_t claim(size_t count) {
+            const size_t first = m_claimed.fetch_add(count, std::memory_order_relaxed);
+            if (first > capacity() || count > capacity() - first) [[unlikely]]
+                throw std::length_error("ConcurrentChunkedArray: capacity exceeded");
+            return first;
+        }
+
+        template<typename... Args>
+        void construct_and_publish(size_t idx, Args&&... args) noexcept {
+            T* chunk = install_chunk(Helper::ChunkIndex(idx));
+            const size_t offset = Helper::OffsetIndex(idx);
+            ::new (static_cast<void*>(chunk + offset)) T(std::forward<Args>(args)...);
+            publish(idx, 1, ready_runs(chunk)[offset]);
+        }
+
+        template <class It>
+        void copy_and_publish(size_t first, It it, size_t count) noexcept {
+            if (count == 0)
+                return;
+            const size_t last = first + count;
+            ReadyRun* firstRun = nullptr;
+            uint32_t firstLen = 0;
+            for (size_t idx = first; idx < last; ) {
+                T* chunk = install_chunk(Helper::ChunkIndex(idx));
+                const size_t offset = Helper::OffsetIndex(idx);
+                const size_t n = std::min(CHUNK_SIZE - offset, last - idx);
+                it = std::ranges::uninitialized_copy_n(it, static_cast<std::iter_difference_t<It>>(n),
+                    chunk + offset, std::unreachable_sentinel).in;
+                // Later pieces are marked right away; the first goes through
+                // publish(), which carries on over them.
+                if (firstRun == nullptr) {
+                    firstRun = &ready_runs(chunk)[offset];
+                    firstLen = static_cast<uint32_t>(n);
+                } else {
+                    ready_runs(chunk)[offset].store(static_cast<uint32_t>(n), std::memory_order_seq_cst);
+                }
+                idx += n;
+            }
+            publish(first, firstLen, *firstRun);
+        }
+
+        // Publishes the constructed run [first, first + len). When every
+        // lower index is already published a single CAS does it; otherwise
+        // the run is marked ready for the producer still working below it.
+        // Marks are stored before the published size is read and read after
+        // it is moved, so of two producers finishing adjacent runs at least
+        // one sees the other's: a ready run is never left behind.
+        void publish(size_t first, uint32_t len, ReadyRun& run) noexcept {
+            size_t pos = first;
+            if (m_published.compare_exchange_strong(pos, first + len, std::memory_order_seq_cst)) {
+                pos = first + len;
+            } else {
+                run.store(len, std::memory_order_seq_cst);
+                pos = m_published.load(std::memory_order_seq_cst);
+            }
+            advance(pos);
+        }
+
+        // Moves the published size from pos over every ready run it reaches,
+        // clearing their marks.
+        void advance(size_t pos) noexcept {
+            while (pos < capacity()) {
+                T* chunk = m_table[Helper::ChunkIndex(pos)].load(std::memory_order_acquire);
+                if (chunk == nullptr)
+                    return;
+                ReadyRun& run = ready_runs(chunk)[Helper::OffsetIndex(pos)];
+                const uint32_t len = run.load(std::memory_order_seq_cst);
+                if (len == 0)
+                    return;
+                // Only the producer whose CAS succeeds clears the mark; losers
+                // retry from the position the winner moved to.
+                if (m_published.compare_exchange_strong(pos, pos + len, std::memory_order_seq_cst)) {
+                    run.store(0, std::memory_order_relaxed);
+                    pos += len;
+                }
+            }
+        }
+    };
+}
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <bit>
 #include <cassert>
 #include <concepts>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <limits>
+#include <optional>
 #include <span>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -15,9 +21,19 @@
 #include <algorithm>
 
 #include "ChunkedArray.hpp"
+#include "OrderedChunkedArray.hpp"
+#include "VirtualArray.hpp"
+
+// Conflicting-access detection. Define ENTABLE_ACCESS_CHECKS to 1 (typically in
+// debug / sanitizer builds) to give every component column an atomic reader/writer
+// counter; the default release configuration compiles the counters away entirely.
+#ifndef ENTABLE_ACCESS_CHECKS
+	#define ENTABLE_ACCESS_CHECKS 0
+#endif
 
 namespace entable {
 	static constexpr size_t DEFAULT_DENSE_CHUNK_SIZE = 1024;
+	static constexpr bool ACCESS_CHECKS_ENABLED = (ENTABLE_ACCESS_CHECKS != 0);
 }
 
 namespace utils {
@@ -102,6 +118,151 @@ namespace utils {
 	// Concept for unique types in a parameter pack
 	template<typename... Ts>
 	concept UniqueTypes = all_types_unique_v<Ts...>;
+
+	// -------------------------------------------------------------------------
+	// Aggregate reflection via structured bindings
+	//
+	// aggregate_arity<T> counts the initializers T{...} accepts; field_refs<N>
+	// binds the N members of an aggregate and returns them as a tuple of
+	// references. Members must not be C arrays (brace elision would make the
+	// arity count disagree with the structured binding). At most 16 fields.
+	// -------------------------------------------------------------------------
+	struct any_field {
+		template <typename U>
+		operator U() const; // unevaluated contexts only
+	};
+
+	template <typename T, typename... Probes>
+	constexpr size_t aggregate_arity() {
+		if constexpr (requires { T{ std::declval<Probes>()..., any_field{} }; })
+			return aggregate_arity<T, Probes..., any_field>();
+		else
+			return sizeof...(Probes);
+	}
+
+	static constexpr size_t MAX_REFLECTED_FIELDS = 16;
+
+	template <size_t N, typename T>
+	constexpr auto field_refs(T& t) noexcept {
+		static_assert(N > 0 && N <= MAX_REFLECTED_FIELDS, "Aggregate must have between 1 and 16 fields");
+		if constexpr (N == 1) { auto& [f0] = t; return std::tie(f0); }
+		else if constexpr (N == 2) { auto& [f0, f1] = t; return std::tie(f0, f1); }
+		else if constexpr (N == 3) { auto& [f0, f1, f2] = t; return std::tie(f0, f1, f2); }
+		else if constexpr (N == 4) { auto& [f0, f1, f2, f3] = t; return std::tie(f0, f1, f2, f3); }
+		else if constexpr (N == 5) { auto& [f0, f1, f2, f3, f4] = t; return std::tie(f0, f1, f2, f3, f4); }
+		else if constexpr (N == 6) { auto& [f0, f1, f2, f3, f4, f5] = t; return std::tie(f0, f1, f2, f3, f4, f5); }
+		else if constexpr (N == 7) { auto& [f0, f1, f2, f3, f4, f5, f6] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6); }
+		else if constexpr (N == 8) { auto& [f0, f1, f2, f3, f4, f5, f6, f7] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7); }
+		else if constexpr (N == 9) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8); }
+		else if constexpr (N == 10) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9); }
+		else if constexpr (N == 11) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10); }
+		else if constexpr (N == 12) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11); }
+		else if constexpr (N == 13) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12); }
+		else if constexpr (N == 14) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13); }
+		else if constexpr (N == 15) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14); }
+		else if constexpr (N == 16) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = t; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15); }
+	}
+
+	template <typename T>
+	using aggregate_field_refs_t = decltype(field_refs<aggregate_arity<T>()>(std::declval<T&>()));
+
+	// -------------------------------------------------------------------------
+	// Minimal fork/join helper
+	//
+	// Splits [0, count) into at most `threads` contiguous ranges and calls
+	// fn(worker, begin, end) for each, the first range on the calling thread.
+	// threads == 0 selects std::thread::hardware_concurrency(). The first
+	// exception thrown by any worker is rethrown after all of them joined.
+	// Ranges whose thread cannot be started run on the calling thread.
+	// -------------------------------------------------------------------------
+	template <typename Fn>
+	void parallel_for(size_t count, size_t threads, Fn&& fn) {
+		if (count == 0) return;
+		if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+		threads = std::min(threads, count);
+		if (threads == 1) {
+			fn(size_t{ 0 }, size_t{ 0 }, count);
+			return;
+		}
+
+		std::vector<std::exception_ptr> errors(threads);
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+		const auto run = [&](size_t w) {
+			const size_t begin = count * w / threads;
+			const size_t end   = count * (w + 1) / threads;
+			try { fn(w, begin, end); }
+			catch (...) { errors[w] = std::current_exception(); }
+		};
+		size_t spawned = 1;
+		try {
+			for (; spawned < threads; ++spawned)
+				workers.emplace_back(run, spawned);
+		}
+		catch (const std::system_error&) {
+			// Out of threads: the remaining ranges run inline below.
+		}
+		run(0);
+		for (size_t w = spawned; w < threads; ++w)
+			run(w);
+		for (auto& t : workers) t.join();
+		for (auto& e : errors)
+			if (e) std::rethrow_exception(e);
+	}
+
+	// Calls fn(element) for each element of a tuple, with the elements spread
+	// over up to `threads` workers as by parallel_for. Elements must not share
+	// state that fn touches.
+	template <typename Fn, typename TupleT>
+	void parallel_for_each_tuple(Fn&& fn, TupleT& tp, size_t threads) {
+		constexpr size_t N = std::tuple_size_v<std::remove_cv_t<TupleT>>;
+		parallel_for(N, threads, [&fn, &tp](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				[&]<size_t... Is>(std::index_sequence<Is...>) {
+					((i == Is ? static_cast<void>(fn(std::get<Is>(tp))) : void()), ...);
+				}(std::make_index_sequence<N>{});
+			}
+		});
+	}
+
+	// -------------------------------------------------------------------------
+	// SIMD-friendly span reduction
+	//
+	// Keeps LANES independent accumulators so the loop-carried dependency is
+	// broken; compilers map them onto vector lanes without needing to
+	// reassociate floating point math themselves. `reduce` must therefore be
+	// associative and commutative. The accumulators are seeded from the first
+	// LANES elements, so no identity value is required. `s` must be non-empty.
+	// -------------------------------------------------------------------------
+	template <size_t LANES = 8, typename T, typename U, typename ReduceOp, typename Transform>
+	T transform_reduce_span(std::span<const U> s, ReduceOp& reduce, Transform& transform) {
+		assert(!s.empty());
+		const U* p = s.data();
+		const size_t n = s.size();
+		if (n < LANES) {
+			T acc = std::invoke(transform, p[0]);
+			for (size_t i = 1; i < n; ++i)
+				acc = std::invoke(reduce, acc, std::invoke(transform, p[i]));
+			return acc;
+		}
+
+		// Built from the first LANES elements: T need not be default-constructible.
+		auto lanes = [&]<size_t... Ls>(std::index_sequence<Ls...>) {
+			return std::array<T, LANES>{ static_cast<T>(std::invoke(transform, p[Ls]))... };
+		}(std::make_index_sequence<LANES>{});
+		size_t i = LANES;
+		for (; i + LANES <= n; i += LANES) {
+			for (size_t l = 0; l < LANES; ++l)
+				lanes[l] = std::invoke(reduce, lanes[l], std::invoke(transform, p[i + l]));
+		}
+		for (; i < n; ++i)
+			lanes[0] = std::invoke(reduce, lanes[0], std::invoke(transform, p[i]));
+		for (size_t w = LANES / 2; w > 0; w /= 2) {
+			for (size_t l = 0; l < w; ++l)
+				lanes[l] = std::invoke(reduce, lanes[l], lanes[l + w]);
+		}
+		return lanes[0];
+	}
 }
 
 namespace entable {
@@ -170,260 +331,2046 @@ namespace entable {
 		return (EntityToVersion(entity) + 1u) & EntityTraits::VERSION_MASK;
 	}
 
-	template <auto CHUNK_SIZE = DEFAULT_DENSE_CHUNK_SIZE, typename... Cs>
-	class Registry;
+	// -------------------------------------------------------------------------
+	// Per-column access tracking
+	//
+	// state >  0 : number of active readers
+	// state == 0 : idle
+	// state == -1: one active writer
+	//
+	// Any read overlapping a write, or two overlapping writes, throws. Conflicts
+	// raised from noexcept housekeeping (Clear, ShrinkToFit) therefore terminate,
+	// which is the intended outcome for a debug-only diagnostic. A registry that
+	// reported a conflict mid-operation is left in an unspecified (but
+	// destructible) state.
+	// -------------------------------------------------------------------------
+	template <bool ENABLED>
+	class AccessCounter;
 
-	template <typename TypedRegistry, typename T>
-	class ComponentStorage {
+	template <>
+	class AccessCounter<false> {
 	public:
-		template<auto CHUNK_SIZE2, typename... Cs2>
-		friend class Registry;
+		FORCE_INLINE constexpr void BeginRead()  const noexcept {}
+		FORCE_INLINE constexpr void EndRead()    const noexcept {}
+		FORCE_INLINE constexpr void BeginWrite() const noexcept {}
+		FORCE_INLINE constexpr void EndWrite()   const noexcept {}
+	};
 
-		using MyStoredType = T;
-		using IndexType = Entity::IdType;
-		static constexpr size_t CHUNK_SIZE = TypedRegistry::ChunkSize;
-		static constexpr bool IsContiguous = TypedRegistry::IsContiguous;
-		using DataStorage = std::conditional_t<IsContiguous, std::vector<T>, ChunkedArray<T, CHUNK_SIZE>>;
-		using EntityStorage = std::conditional_t<IsContiguous, std::vector<Entity>, ChunkedArray<Entity, CHUNK_SIZE>>;
-		using SparseStorage = std::conditional_t<IsContiguous, std::vector<uint32_t>, ChunkedArray<uint32_t, CHUNK_SIZE>>;
+	template <>
+	class AccessCounter<true> {
+	public:
+		AccessCounter() = default;
+		// Counters describe in-flight access to one particular column; they are
+		// never transferred when the owning storage is moved.
+		AccessCounter(const AccessCounter&) noexcept {}
+		AccessCounter& operator=(const AccessCounter&) noexcept { return *this; }
+
+		void BeginRead() const {
+			int32_t s = state.load(std::memory_order_relaxed);
+			do {
+				if (s < 0) [[unlikely]]
+					throw std::runtime_error("Conflicting component access (read during write)");
+			} while (!state.compare_exchange_weak(s, s + 1, std::memory_order_acquire, std::memory_order_relaxed));
+		}
 
-		explicit ComponentStorage(TypedRegistry& r)
-			: regPtr(&r)
-		{}
+		void EndRead() const noexcept {
+			state.fetch_sub(1, std::memory_order_release);
+		}
+
+		void BeginWrite() const {
+			int32_t expected = 0;
+			if (!state.compare_exchange_strong(expected, -1, std::memory_order_acquire, std::memory_order_relaxed)) [[unlikely]] {
+				throw std::runtime_error(expected > 0
+					? "Conflicting component access (write during read)"
+					: "Conflicting component access (write during write)");
+			}
+		}
+
+		void EndWrite() const noexcept {
+			state.store(0, std::memory_order_release);
+		}
+
+		[[nodiscard]] int32_t State() const noexcept { return state.load(std::memory_order_relaxed); }
 
 	private:
-		void Init(IndexType entityIndex, Entity entity) {
-			const size_t slot = data.size();
-			data.emplace_back();
-			slotToEntity.emplace_back(entity);
-			EnsureSparseSlot(entityIndex);
-			indexToSlot[entityIndex] = static_cast<uint32_t>(slot);
+		mutable std::atomic<int32_t> state{ 0 };
+	};
+
+	using ColumnAccessCounter = AccessCounter<ACCESS_CHECKS_ENABLED>;
+
+	// RAII scope over one column counter. Non-copyable and non-movable so that a
+	// scope can never be released twice; aggregate several with std::tuple.
+	template <bool WRITE, bool ENABLED = ACCESS_CHECKS_ENABLED>
+	class AccessGuard {
+	public:
+		explicit constexpr AccessGuard(const AccessCounter<false>&) noexcept {}
+		AccessGuard(const AccessGuard&) = delete;
+		AccessGuard& operator=(const AccessGuard&) = delete;
+	};
+
+	template <bool WRITE>
+	class AccessGuard<WRITE, true> {
+	public:
+		explicit AccessGuard(const AccessCounter<true>& c)
+			: counter(&c)
+		{
+			if constexpr (WRITE) counter->BeginWrite();
+			else                 counter->BeginRead();
 		}
 
-		void Kill(IndexType entityIndex) {
-			const size_t slot = indexToSlot[entityIndex];
-			const size_t last = data.size() - 1;
+		~AccessGuard() {
+			if constexpr (WRITE) counter->EndWrite();
+			else                 counter->EndRead();
+		}
+
+		AccessGuard(const AccessGuard&) = delete;
+		AccessGuard& operator=(const AccessGuard&) = delete;
+
+	private:
+		const AccessCounter<true>* counter;
+	};
+
+	// One guard per column named in a pack, e.g. AccessScope<true, A, B>.
+	template <typename T, bool WRITE>
+	using ColumnAccessGuard = AccessGuard<WRITE>;
+
+	template <bool WRITE, typename... Ts>
+	using AccessScope = std::tuple<ColumnAccessGuard<Ts, WRITE>...>;
+
+	// -------------------------------------------------------------------------
+	// Per-component configuration
+	//
+	// Specialize UserConfig<T> to opt a component into optional storage
+	// features. The primary template enables none of them. Recognised members:
+	//
+	//   static Key SummaryKey(const T&)
+	//       Maintain per-chunk min/max of the returned (totally ordered) key so
+	//       that EachWhere<T, ...> can skip whole chunks.
+	//
+	//   static constexpr bool SplitFields = true
+	//       Store an aggregate T as one column per member. Get / Each yield
+	//       SplitReference proxies instead of T&; member spans are available
+	//       through FieldComponents<T, I>(). TryGet / Components are disabled.
+	//
+	//   static constexpr bool StableAddresses = true
+	//       Destroying an entity leaves a tombstone in T's column instead of
+	//       moving the last element into the hole; the next entity reuses it.
+	//       Pointers from TryGet stay valid for the entity's lifetime. Needs
+	//       chunked storage. Direct-layout registries are stable already.
+	//
+	//   static constexpr size_t PackedBits = 1
+	//       Store a bool, integral or enum component in PackedBits bits (1, 2,
+	//       4, 8, 16 or 32) of shared 64-bit words. Get / Each yield
+	//       PackedReference proxies; CountEqual / EachEqual test 64 / PackedBits
+	//       entities per word. Values must fit in PackedBits unsigned bits.
+	//
+	//   static Key IndexKey(const T&)
+	//   static constexpr bool UniqueIndex = true    (optional)
+	//       Maintain a hash index from the returned key to the entities
+	//       holding it, for FindBy / FindAllBy / CountBy<T>(key). Key needs
+	//       operator== and std::hash. UniqueIndex makes Set throw on a key
+	//       another entity already holds. The key of T{} is never indexed.
+	//
+	//   static Key OrderKey(const T&)
+	//       Maintain an index sorted by the returned (totally ordered) key for
+	//       RangeEach / OrderedEach<T> in key order, O(log N) plus the
+	//       entities visited. The key of T{} is never indexed.
+	//
+	//   static constexpr size_t ChunkBytes = 64 * 1024
+	//       Size T's data chunks by a byte budget instead of the registry's
+	//       chunk size: ChunkBytes / sizeof(T) elements, rounded down to a
+	//       power of two. Ignored by contiguous (CHUNK_SIZE = 0) registries.
+	// -------------------------------------------------------------------------
+	template <typename T>
+	struct UserConfig {};
+
+	template <typename T>
+	concept HasSummaryKey = requires(const T& t) {
+		{ UserConfig<T>::SummaryKey(t) } -> std::totally_ordered;
+	};
 
-			if (slot != last) {
-				data[slot] = std::move(data[last]);
-				const Entity movedEntity = slotToEntity[last];
-				slotToEntity[slot] = movedEntity;
-				indexToSlot[EntityToIndex(movedEntity)] = static_cast<uint32_t>(slot);
+	template <typename Key>
+	struct KeyRange {
+		Key min{};
+		Key max{};
+	};
+
+	// Lazily maintained zone map over a dense column: one KeyRange per granule
+	// of GRANULE slots. Writes only flag their granule as dirty; ranges are
+	// recomputed on the next Refresh(). Removing elements never invalidates a
+	// range (it stays a conservative bound), so only writes that introduce new
+	// values need to mark anything.
+	template <typename T, size_t GRANULE>
+	class ColumnSummaries {
+	public:
+		using KeyType   = std::remove_cvref_t<decltype(UserConfig<T>::SummaryKey(std::declval<const T&>()))>;
+		using RangeType = KeyRange<KeyType>;
+
+		FORCE_INLINE void MarkDirty(size_t slot) noexcept {
+			const size_t g = slot / GRANULE;
+			// Granules past the end are created dirty by Refresh().
+			if (g < dirty.size()) dirty[g] = 1;
+		}
+
+		// Flags every granule overlapping slots [lo, hi).
+		FORCE_INLINE void MarkDirty(size_t lo, size_t hi) noexcept {
+			const size_t end = std::min((hi + GRANULE - 1) / GRANULE, dirty.size());
+			for (size_t g = lo / GRANULE; g < end; ++g)
+				dirty[g] = 1;
+		}
+
+		void MarkAllDirty() noexcept {
+			std::fill(dirty.begin(), dirty.end(), uint8_t{ 1 });
+		}
+
+		void Clear() noexcept {
+			ranges.clear();
+			dirty.clear();
+		}
+
+		// Recomputes every dirty granule covering data[0, count).
+		template <typename Data>
+		void Refresh(const Data& data, size_t count) {
+			const size_t granules = (count + GRANULE - 1) / GRANULE;
+			if (ranges.size() < granules) {
+				ranges.resize(granules);
+				dirty.resize(granules, uint8_t{ 1 });
+			}
+			for (size_t g = 0; g < granules; ++g) {
+				if (!dirty[g]) continue;
+				const size_t lo = g * GRANULE;
+				const size_t hi = std::min(lo + GRANULE, count);
+				// Granules never straddle a chunk, so the run is contiguous.
+				const T* p = &data[lo];
+				RangeType r{ UserConfig<T>::SummaryKey(p[0]), UserConfig<T>::SummaryKey(p[0]) };
+				for (size_t i = 1; i < hi - lo; ++i) {
+					const KeyType k = UserConfig<T>::SummaryKey(p[i]);
+					if (k < r.min) r.min = k;
+					if (r.max < k) r.max = k;
+				}
+				ranges[g] = r;
+				dirty[g] = 0;
 			}
+		}
 
-			data.pop_back();
-			slotToEntity.pop_back();
+		[[nodiscard]] bool IsClean(size_t granule) const noexcept {
+			return granule < dirty.size() && !dirty[granule];
 		}
 
-		// Unchecked - caller guarantees entity is live.
-		template<typename... Args>
-		void Set(IndexType entityIndex, Args&&... args) {
-			data[indexToSlot[entityIndex]] = MyStoredType{ std::forward<Args>(args)... };
+		[[nodiscard]] const RangeType& Range(size_t granule) const noexcept {
+			return ranges[granule];
 		}
 
-		// Unchecked - caller guarantees entity is live.
-		[[nodiscard]] decltype(auto) Get(IndexType entityIndex) {
-			return data[indexToSlot[entityIndex]];
+	private:
+		std::vector<RangeType> ranges;
+		std::vector<uint8_t>   dirty;
+	};
+
+	struct NoColumnSummaries {
+		FORCE_INLINE constexpr void MarkDirty(size_t) noexcept {}
+		FORCE_INLINE constexpr void MarkDirty(size_t, size_t) noexcept {}
+		FORCE_INLINE constexpr void MarkAllDirty() noexcept {}
+		FORCE_INLINE constexpr void Clear() noexcept {}
+	};
+
+	// Calls fn(i) for every set bit i in [lo, hi) of a bitmap stored as 64-bit
+	// words. Fully set words are walked without bit scanning.
+	template <typename Fn>
+	FORCE_INLINE void ForEachSetBit(std::span<const uint64_t> words, size_t lo, size_t hi, Fn&& fn) {
+		for (size_t w = lo / 64; w * 64 < hi; ++w) {
+			const size_t first = w * 64;
+			uint64_t bits = words[w];
+			if (first < lo) bits &= ~uint64_t{ 0 } << (lo - first);
+			if (hi - first < 64) bits &= (uint64_t{ 1 } << (hi - first)) - 1;
+			if (bits == ~uint64_t{ 0 }) {
+				for (size_t i = first; i < first + 64; ++i) fn(i);
+				continue;
+			}
+			for (; bits != 0; bits &= bits - 1)
+				fn(first + static_cast<size_t>(std::countr_zero(bits)));
 		}
+	}
 
-		[[nodiscard]] decltype(auto) Get(IndexType entityIndex) const {
-			return data[indexToSlot[entityIndex]];
+	// Tombstone bookkeeping of a StableAddresses column: one bit per slot, set
+	// while the slot is live, and a LIFO list of dead slots to reuse.
+	struct SlotTombstones {
+		std::vector<uint64_t> live;
+		std::vector<uint32_t> freeSlots;
+
+		void clear() noexcept {
+			live.clear();
+			freeSlots.clear();
 		}
+	};
 
-		[[nodiscard]] decltype(auto) GetByDenseSlotUnchecked(size_t slot) {
-			return data[slot];
+	// Calls fn(std::span<U>) for each contiguous run of `column`: per live chunk
+	// of a ChunkedArray, or SPAN-sized slices of a contiguous VirtualArray.
+	template <size_t SPAN, typename Column, typename Fn>
+	void ForEachColumnSpan(Column& column, Fn&& fn) {
+		if constexpr (requires { column.for_each_chunk(fn); }) {
+			column.for_each_chunk(fn);
+		} else {
+			using U = std::remove_reference_t<decltype(*column.data())>;
+			const size_t totalSize = column.size();
+			for (size_t start = 0; start < totalSize; start += SPAN)
+				fn(std::span<U>(column.data() + start, std::min(SPAN, totalSize - start)));
 		}
+	}
 
-		[[nodiscard]] decltype(auto) GetByDenseSlotUnchecked(size_t slot) const {
-			return data[slot];
+	// Deep copy of a column: clone() for the move-only column types, the copy
+	// constructor for everything else.
+	template <typename Column>
+	[[nodiscard]] Column CloneColumn(const Column& column) {
+		if constexpr (requires { column.clone(); })
+			return column.clone();
+		else
+			return column;
+	}
+
+	// column[dst] = std::move(column[src]): move_element() for columns whose
+	// elements are proxies (field-split), plain move assignment otherwise.
+	template <typename Column>
+	void MoveColumnElement(Column& column, size_t dst, size_t src) {
+		if constexpr (requires { column.move_element(dst, src); })
+			column.move_element(dst, src);
+		else
+			column[dst] = std::move(column[src]);
+	}
+
+	// Copy-on-write copy of a column: fork() for copy-on-write chunked arrays
+	// and the columns built on them, the copy constructor for everything else.
+	template <typename Column>
+	[[nodiscard]] Column ForkColumn(Column& column) {
+		if constexpr (requires { column.fork(); })
+			return column.fork();
+		else
+			return column;
+	}
+
+	// -------------------------------------------------------------------------
+	// Field-split column storage
+	//
+	// Stores an aggregate T as one Column<Field> per member, so a sweep over a
+	// few members never pulls the others through the cache and every member is
+	// a contiguous array of scalars. Elements are accessed through
+	// SplitReference proxies that support structured bindings (one reference
+	// per member), get<I>(), conversion to T and assignment from T.
+	// -------------------------------------------------------------------------
+	template <typename T>
+	concept SplitsFields = requires { requires static_cast<bool>(UserConfig<T>::SplitFields); };
+
+	template <typename T>
+	concept HasStableAddresses = requires { requires static_cast<bool>(UserConfig<T>::StableAddresses); };
+
+	template <typename T>
+	concept HasPackedBits = requires { { UserConfig<T>::PackedBits } -> std::convertible_to<size_t>; };
+
+	template <typename T>
+	concept HasChunkBytes = requires { { UserConfig<T>::ChunkBytes } -> std::convertible_to<size_t>; };
+
+	// Elements per data chunk of T in a registry with REGISTRY_CHUNK: derived
+	// from UserConfig<T>::ChunkBytes when given, never below MIN_CHUNK.
+	template <typename T, size_t REGISTRY_CHUNK, size_t MIN_CHUNK>
+	consteval size_t ComponentChunkSize() {
+		if constexpr (REGISTRY_CHUNK == 0 || !HasChunkBytes<T>) {
+			return REGISTRY_CHUNK;
+		} else {
+			const size_t elements = static_cast<size_t>(UserConfig<T>::ChunkBytes) / sizeof(T);
+			return std::max(MIN_CHUNK, std::bit_floor(std::max<size_t>(elements, 1)));
 		}
+	}
 
-		[[nodiscard]] MyStoredType* TryGet(IndexType entityIndex) noexcept {
-			return &data[indexToSlot[entityIndex]];
+	// Member types of an aggregate, as reflected by field_refs.
+	template <typename T>
+	struct AggregateFields {
+		static_assert(std::is_aggregate_v<T>, "SplitFields requires an aggregate component");
+		static constexpr size_t Count = aggregate_arity<T>();
+		using Indices = std::make_index_sequence<Count>;
+
+		template <size_t I>
+		using Type = std::remove_reference_t<std::tuple_element_t<I, aggregate_field_refs_t<T>>>;
+
+		template <typename Seq> struct Expand;
+		template <size_t... Is>
+		struct Expand<std::index_sequence<Is...>> {
+			template <template <typename> class Column>
+			using Columns = std::tuple<Column<Type<Is>>...>;
+			template <bool IsConst>
+			using Refs = std::tuple<std::conditional_t<IsConst, const Type<Is>&, Type<Is>&>...>;
+		};
+
+		template <template <typename> class Column>
+		using Columns = typename Expand<Indices>::template Columns<Column>;
+		template <bool IsConst>
+		using Refs = typename Expand<Indices>::template Refs<IsConst>;
+	};
+
+	template <typename T, bool IsConst>
+	class SplitReference {
+		using Fields = AggregateFields<T>;
+
+	public:
+		using Refs = typename Fields::template Refs<IsConst>;
+
+		explicit SplitReference(const Refs& r) noexcept
+			: refs(r)
+		{}
+
+		SplitReference(const SplitReference&) = default;
+
+		template <size_t I>
+		[[nodiscard]] decltype(auto) get() const noexcept { return std::get<I>(refs); }
+
+		[[nodiscard]] operator T() const {
+			return std::apply([](const auto&... f) { return T{ f... }; }, refs);
 		}
 
-		[[nodiscard]] const MyStoredType* TryGet(IndexType entityIndex) const noexcept {
-			return &data[indexToSlot[entityIndex]];
+		// Assignment writes through to the referenced members; it never rebinds.
+		const SplitReference& operator=(const SplitReference& other) const requires (!IsConst) {
+			Assign(other.refs, typename Fields::Indices{});
+			return *this;
 		}
 
-		// Returns the size of the dense data array (number of components stored)
-		[[nodiscard]] size_t DenseSize() const noexcept {
-			return data.size();
+		template <bool OtherConst>
+		const SplitReference& operator=(const SplitReference<T, OtherConst>& other) const requires (!IsConst && OtherConst) {
+			Assign(other.refs, typename Fields::Indices{});
+			return *this;
 		}
 
-		void Clear() noexcept {
-			data.clear();
-			slotToEntity.clear();
-			indexToSlot.clear();
+		const SplitReference& operator=(const T& value) const requires (!IsConst) {
+			const auto src = field_refs<Fields::Count>(value);
+			Assign(src, typename Fields::Indices{});
+			return *this;
 		}
 
-		void ShrinkToFit() noexcept {
-			data.shrink_to_fit();
+		const SplitReference& operator=(T&& value) const requires (!IsConst) {
+			auto src = field_refs<Fields::Count>(value);
+			MoveAssign(src, typename Fields::Indices{});
+			return *this;
 		}
 
-		[[nodiscard]] const MyStoredType* GetPointerAt(size_t slot) const noexcept {
-			return &data[slot];
+	private:
+		template <typename, bool> friend class SplitReference;
+
+		template <typename Src, size_t... Is>
+		void Assign(const Src& src, std::index_sequence<Is...>) const {
+			((std::get<Is>(refs) = std::get<Is>(src)), ...);
 		}
 
-		[[nodiscard]] auto GetDataSpans() noexcept {
-			std::vector<std::span<MyStoredType>> result;
-			if constexpr (IsContiguous) {
-				// For contiguous storage (std::vector), emulate chunks of DEFAULT_DENSE_CHUNK_SIZE
-				// This ensures consistent chunk-based parallel iteration across all storage types
-				const size_t totalSize = data.size();
-				const size_t numChunks = (totalSize + DEFAULT_DENSE_CHUNK_SIZE - 1) / DEFAULT_DENSE_CHUNK_SIZE;
-				result.reserve(numChunks);
-				for (size_t i = 0; i < numChunks; ++i) {
-					const size_t start = i * DEFAULT_DENSE_CHUNK_SIZE;
-					const size_t end = std::min(start + DEFAULT_DENSE_CHUNK_SIZE, totalSize);
-					result.emplace_back(data.data() + start, end - start);
-				}
-			} else {
-				// For chunked storage, return span per chunk
-				const size_t numChunks = data.chunk_count();
-				const size_t totalSize = data.size();
-				result.reserve(numChunks);
-				for (size_t i = 0; i < numChunks; ++i) {
-					MyStoredType* chunkPtr = data.get_chunk_ptr(i);
-					const bool isLast = (i == numChunks - 1);
-					const size_t elemsInChunk = isLast
-						? (totalSize - i * CHUNK_SIZE)
-						: CHUNK_SIZE;
-					result.emplace_back(chunkPtr, elemsInChunk);
-				}
-			}
-			return result;
+		template <typename Src, size_t... Is>
+		void MoveAssign(Src& src, std::index_sequence<Is...>) const {
+			((std::get<Is>(refs) = std::move(std::get<Is>(src))), ...);
 		}
 
-		[[nodiscard]] auto GetDataSpans() const noexcept {
-			std::vector<std::span<const MyStoredType>> result;
-			if constexpr (IsContiguous) {
-				// For contiguous storage (std::vector), emulate chunks of DEFAULT_DENSE_CHUNK_SIZE
-				// This ensures consistent chunk-based parallel iteration across all storage types
-				const size_t totalSize = data.size();
-				const size_t numChunks = (totalSize + DEFAULT_DENSE_CHUNK_SIZE - 1) / DEFAULT_DENSE_CHUNK_SIZE;
-				result.reserve(numChunks);
-				for (size_t i = 0; i < numChunks; ++i) {
-					const size_t start = i * DEFAULT_DENSE_CHUNK_SIZE;
-					const size_t end = std::min(start + DEFAULT_DENSE_CHUNK_SIZE, totalSize);
-					result.emplace_back(data.data() + start, end - start);
-				}
-			} else {
-				// For chunked storage, return span per chunk
-				const size_t numChunks = data.chunk_count();
-				const size_t totalSize = data.size();
-				result.reserve(numChunks);
-				for (size_t i = 0; i < numChunks; ++i) {
-					const MyStoredType* chunkPtr = data.get_chunk_ptr(i);
-					const bool isLast = (i == numChunks - 1);
-					const size_t elemsInChunk = isLast
-						? (totalSize - i * CHUNK_SIZE)
-						: CHUNK_SIZE;
-					result.emplace_back(chunkPtr, elemsInChunk);
-				}
-			}
-			return result;
+		Refs refs;
+	};
+
+	template <typename T, template <typename> class Column>
+	class SplitColumns {
+		using Fields  = AggregateFields<T>;
+		using Indices = typename Fields::Indices;
+
+	public:
+		using reference       = SplitReference<T, false>;
+		using const_reference = SplitReference<T, true>;
+
+		template <size_t I>
+		using FieldType = typename Fields::template Type<I>;
+
+		static constexpr size_t FieldCount = Fields::Count;
+
+		[[nodiscard]] reference operator[](size_t idx) noexcept {
+			return At<false>(*this, idx, Indices{});
 		}
 
-		void EnsureSparseSlot(IndexType entityIndex) {
-			if constexpr (IsContiguous) {
-				if (indexToSlot.size() <= static_cast<size_t>(entityIndex)) {
-					indexToSlot.resize(static_cast<size_t>(entityIndex) + 1);
-				}
-			} else {
-				indexToSlot.ensure_size(static_cast<size_t>(entityIndex) + 1);
-			}
+		[[nodiscard]] const_reference operator[](size_t idx) const noexcept {
+			return At<true>(*this, idx, Indices{});
+		}
+
+		[[nodiscard]] size_t size() const noexcept { return std::get<0>(columns).size(); }
+
+		void emplace_back() {
+			T value{};
+			auto src = field_refs<FieldCount>(value);
+			EmplaceAll(src, Indices{});
+		}
+
+		void pop_back() {
+			std::apply([](auto&... c) { (c.pop_back(), ...); }, columns);
 		}
 
+		// Moves element src into dst member by member. Assigning one proxy to
+		// another would copy each member instead.
+		void move_element(size_t dst, size_t src) {
+			std::apply([dst, src](auto&... c) { ((c[dst] = std::move(c[src])), ...); }, columns);
+		}
+
+		void clear() {
+			std::apply([](auto&... c) { (c.clear(), ...); }, columns);
+		}
+
+		void shrink_to_fit() {
+			std::apply([](auto&... c) { (c.shrink_to_fit(), ...); }, columns);
+		}
+
+		[[nodiscard]] SplitColumns clone() const {
+			SplitColumns copy;
+			copy.columns = std::apply([](const auto&... c) {
+				return typename Fields::template Columns<Column>(CloneColumn(c)...);
+			}, columns);
+			return copy;
+		}
+
+		[[nodiscard]] SplitColumns fork() {
+			SplitColumns copy;
+			copy.columns = std::apply([](auto&... c) {
+				return typename Fields::template Columns<Column>(c.fork()...);
+			}, columns);
+			return copy;
+		}
+
+		template <size_t I>
+		[[nodiscard]] Column<FieldType<I>>& Field() noexcept { return std::get<I>(columns); }
+
+		template <size_t I>
+		[[nodiscard]] const Column<FieldType<I>>& Field() const noexcept { return std::get<I>(columns); }
+
 	private:
-		DataStorage   data;
-		EntityStorage slotToEntity;
-		SparseStorage indexToSlot;
-		TypedRegistry* regPtr = nullptr;
+		template <bool IsConst, typename Self, size_t... Is>
+		static SplitReference<T, IsConst> At(Self& self, size_t idx, std::index_sequence<Is...>) noexcept {
+			using Refs = typename SplitReference<T, IsConst>::Refs;
+			return SplitReference<T, IsConst>(Refs(std::get<Is>(self.columns)[idx]...));
+		}
+
+		template <typename Src, size_t... Is>
+		void EmplaceAll(Src& src, std::index_sequence<Is...>) {
+			(std::get<Is>(columns).emplace_back(std::move(std::get<Is>(src))), ...);
+		}
+
+		typename Fields::template Columns<Column> columns;
 	};
 
 	// -------------------------------------------------------------------------
-	// Registry
+	// Bit-packed columns (UserConfig<T>::PackedBits)
+	//
+	// A bool, integral or enum component stored BITS bits per element, 64 / BITS
+	// elements per uint64_t word. Elements are accessed through PackedReference
+	// proxies (conversion to T, assignment from T); a lane past the end of the
+	// column is always zero. MatchMask compares a whole word against a value at
+	// once, which CountEqual / ForEachEqual / FindNext build on.
 	// -------------------------------------------------------------------------
-	template<auto CHUNK_SIZE, typename... Cs>
-	class Registry {
-	public:
-		using Self = Registry<CHUNK_SIZE, Cs...>;
-		using TypesList = std::tuple<Cs...>;
-		using StoragesTuple = std::tuple<ComponentStorage<Self, Cs>...>;
-		static constexpr size_t ChunkSize = CHUNK_SIZE;
-		static constexpr bool IsContiguous = (CHUNK_SIZE == 0);
+	template <typename T, size_t BITS>
+	struct PackedLanes {
+		static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "PackedBits requires a bool, integral or enum component");
+		static_assert(BITS > 0 && BITS <= 32 && 64 % BITS == 0, "PackedBits must be 1, 2, 4, 8, 16 or 32");
+
+		static constexpr size_t PerWord = 64 / BITS;
+		static constexpr uint64_t LaneMask = (uint64_t{ 1 } << BITS) - 1;
+		// Lowest bit of every lane.
+		static constexpr uint64_t LowBits = ~uint64_t{ 0 } / LaneMask;
+
+		[[nodiscard]] static constexpr uint64_t ToBits(T value) noexcept {
+			uint64_t bits;
+			if constexpr (std::is_enum_v<T>) bits = static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(value));
+			else bits = static_cast<uint64_t>(value);
+			assert((bits & ~LaneMask) == 0 && "component value does not fit in PackedBits");
+			return bits & LaneMask;
+		}
 
-		template <typename, typename>
-		friend class ComponentStorage;
+		[[nodiscard]] static constexpr T FromBits(uint64_t bits) noexcept {
+			if constexpr (std::is_same_v<T, bool>) return bits != 0;
+			else if constexpr (std::is_enum_v<T>) return static_cast<T>(static_cast<std::underlying_type_t<T>>(bits));
+			else return static_cast<T>(bits);
+		}
 
-	public:
-		Registry()
-			: storages(ComponentStorage<Self, Cs>(*this)...)
-		{
-			static_assert(NUM_COMPONENTS > 0, "Define at least one component at Registry type level");
-			(ValidateChunk<Cs>(), ...);
-			(ValidateDefaultInitializable<Cs>(), ...);
+		// Lowest bit of each lane of `word` that equals `value`.
+		[[nodiscard]] static constexpr uint64_t MatchMask(uint64_t word, T value) noexcept {
+			uint64_t diff = word ^ (ToBits(value) * LowBits);
+			for (size_t shift = 1; shift < BITS; shift <<= 1)
+				diff |= diff >> shift;
+			return ~diff & LowBits;
 		}
+	};
 
-		~Registry() { Clear(); }
-		Registry(const Registry&) = delete;
-		Registry(Registry&&) noexcept = delete;
-		Registry& operator=(const Registry&) = delete;
-		Registry& operator=(Registry&&) noexcept = delete;
+	template <typename T, size_t BITS, bool IsConst>
+	class PackedReference {
+		using Lanes = PackedLanes<T, BITS>;
+		using WordPtr = std::conditional_t<IsConst, const uint64_t*, uint64_t*>;
 
 	public:
-		Entity CreateEntity() {
-			Entity entity;
+		PackedReference(WordPtr w, size_t lane) noexcept
+			: word(w), shift(static_cast<uint32_t>(lane * BITS))
+		{}
 
-			if (fSize > 0) {
-				// Reuse from free list
-				const auto i = fNext;
-				fNext = EntityToIndex(entities[i]);  // Get next from current head
-				--fSize;
+		PackedReference(const PackedReference&) = default;
 
-				const auto v = EntityToVersion(entities[i]);
-				entities[i] = ComposeEntity(i, v);   // Mark as live
-				entity = entities[i];
+		[[nodiscard]] T get() const noexcept { return Lanes::FromBits((*word >> shift) & Lanes::LaneMask); }
+		[[nodiscard]] operator T() const noexcept { return get(); }
 
-				for_each_tuple([&entity, i](auto& s) {
-					s.Init(i, entity);
-				}, storages);
-			}
-			else {
-				// Allocate fresh slot
-				if (entities.size() >= EntityTraits::INVALID_INDEX) {
-					throw std::runtime_error("Can't create Entity (too many entities)");
-				}
-				entity = entities.emplace_back(ComposeEntity(
-					static_cast<uint32_t>(entities.size()),
-					0u
-				));
+		// Assignment writes the referenced lane; it never rebinds.
+		const PackedReference& operator=(T value) const noexcept requires (!IsConst) {
+			*word = (*word & ~(Lanes::LaneMask << shift)) | (Lanes::ToBits(value) << shift);
+			return *this;
+		}
 
-				for_each_tuple([&entity](auto& s) {
-					s.Init(EntityToIndex(entity), entity);
-				}, storages);
-			}
+		const PackedReference& operator=(const PackedReference& other) const noexcept requires (!IsConst) {
+			return *this = other.get();
+		}
 
-			return entity;
+	private:
+		WordPtr  word;
+		uint32_t shift;
+	};
+
+	template <typename T, size_t BITS, template <typename> class Column>
+	class PackedColumn {
+		using Lanes = PackedLanes<T, BITS>;
+
+	public:
+		using reference       = PackedReference<T, BITS, false>;
+		using const_reference = PackedReference<T, BITS, true>;
+
+		static constexpr size_t Bits = BITS;
+		static constexpr size_t LanesPerWord = Lanes::PerWord;
+
+		[[nodiscard]] reference operator[](size_t idx) noexcept {
+			return reference(&words[idx / LanesPerWord], idx % LanesPerWord);
 		}
 
-		void DestroyEntity(Entity entity) {
-			CheckEntity(entity);
+		[[nodiscard]] const_reference operator[](size_t idx) const noexcept {
+			return const_reference(&words[idx / LanesPerWord], idx % LanesPerWord);
+		}
+
+		[[nodiscard]] size_t size() const noexcept { return count; }
+
+		void emplace_back() {
+			if (count % LanesPerWord == 0)
+				words.emplace_back(uint64_t{ 0 });
+			++count;
+		}
+
+		void pop_back() noexcept {
+			--count;
+			if (count % LanesPerWord == 0) words.pop_back();
+			else (*this)[count] = T{};
+		}
+
+		void reserve(size_t n) {
+			if constexpr (requires { words.reserve(n); })
+				words.reserve((n + LanesPerWord - 1) / LanesPerWord);
+		}
+
+		void clear() noexcept {
+			words.clear();
+			count = 0;
+		}
+
+		void shrink_to_fit() { words.shrink_to_fit(); }
+
+		[[nodiscard]] PackedColumn clone() const {
+			PackedColumn copy;
+			copy.words = CloneColumn(words);
+			copy.count = count;
+			return copy;
+		}
+
+		[[nodiscard]] PackedColumn fork() {
+			PackedColumn copy;
+			copy.words = words.fork();
+			copy.count = count;
+			return copy;
+		}
+
+		// The word column; lanes past size() are zero.
+		[[nodiscard]] const Column<uint64_t>& Words() const noexcept { return words; }
+
+		// Number of elements equal to value, a word at a time.
+		[[nodiscard]] size_t CountEqual(T value) const noexcept {
+			size_t n = 0;
+			for (size_t w = 0; w < words.size(); ++w)
+				n += static_cast<size_t>(std::popcount(Lanes::MatchMask(words[w], value)));
+			// Unused lanes of the last word are zero and match a zero value.
+			if (Lanes::ToBits(value) == 0 && count % LanesPerWord != 0)
+				n -= LanesPerWord - count % LanesPerWord;
+			return n;
+		}
+
+		// Calls fn(idx) for every element in [lo, hi) equal to value, in order.
+		template <typename Fn>
+		void ForEachEqual(T value, size_t lo, size_t hi, Fn&& fn) const {
+			hi = std::min(hi, count);
+			for (size_t w = lo / LanesPerWord; w * LanesPerWord < hi; ++w) {
+				uint64_t match = Lanes::MatchMask(words[w], value);
+				const size_t first = w * LanesPerWord;
+				if (first < lo) match &= ~uint64_t{ 0 } << ((lo - first) * BITS);
+				if (first + LanesPerWord > hi) match &= (uint64_t{ 1 } << ((hi - first) * BITS)) - 1;
+				for (; match != 0; match &= match - 1)
+					fn(first + static_cast<size_t>(std::countr_zero(match)) / BITS);
+			}
+		}
+
+		// First index >= from whose element equals value, or size().
+		[[nodiscard]] size_t FindNext(T value, size_t from) const noexcept {
+			size_t found = count;
+			for (size_t w = from / LanesPerWord; w * LanesPerWord < count; ++w) {
+				uint64_t match = Lanes::MatchMask(words[w], value);
+				if (w == from / LanesPerWord) match &= ~uint64_t{ 0 } << (from % LanesPerWord * BITS);
+				if (match != 0) {
+					found = std::min(count, w * LanesPerWord + static_cast<size_t>(std::countr_zero(match)) / BITS);
+					break;
+				}
+			}
+			return found;
+		}
+
+	private:
+		Column<uint64_t> words;
+		size_t count = 0;
+	};
+
+	template <typename T, template <typename> class Column, bool = HasPackedBits<T>>
+	struct PackedColumnOf { using type = void; };
+
+	template <typename T, template <typename> class Column>
+	struct PackedColumnOf<T, Column, true> { using type = PackedColumn<T, UserConfig<T>::PackedBits, Column>; };
+
+	// -------------------------------------------------------------------------
+	// Registry options
+	//
+	// The first Registry template argument is either a chunk size (0 selects
+	// contiguous VirtualArray columns) or a RegistryOptions value:
+	//
+	//   Registry<RegistryOptions{ .chunkSize = 256, .layout = ColumnLayout::Direct }, Pos, Vel>
+	// -------------------------------------------------------------------------
+	enum class ColumnLayout : uint8_t {
+		// Dense columns plus a sparse entity index -> slot map. Destroying an
+		// entity moves the last element into its slot. Fastest iteration.
+		Packed,
+		// Columns are indexed by EntityToIndex(e) directly; destroyed entities
+		// stay behind as default-constructed holes tracked by an alive bitmap.
+		// Get saves the sparse lookup, iteration skips dead lanes 64 at a time.
+		// Requires a chunk size of 0 or at least 64.
+		Direct,
+	};
+
+	// Order in which destroyed entity indices are handed out again.
+	enum class FreeListPolicy : uint8_t {
+		// Most recently freed first. Cheapest, but under churn the same few
+		// indices cycle through their 12-bit version space quickly.
+		Lifo,
+		// Least recently freed first: maximises the time before an index (and
+		// thus a version) is reused.
+		Fifo,
+		// Lowest free index first, via a bitmap. Keeps live indices packed at
+		// the front so the sparse arrays stay short and the free tail can be
+		// trimmed.
+		LowestIndex,
+	};
+
+	struct RegistryOptions {
+		size_t         chunkSize = DEFAULT_DENSE_CHUNK_SIZE;
+		ColumnLayout   layout    = ColumnLayout::Packed;
+		FreeListPolicy freeList  = FreeListPolicy::Lifo;
+		// Reference-counted chunks shared by Registry::Fork until first written.
+		// Requires chunked storage and trivially copyable components.
+		bool           copyOnWrite = false;
+		// Capacity of a contiguous (chunkSize = 0) registry. Each of its arrays
+		// reserves address space for this many elements up front, so lower it
+		// when many registries coexist or on 32-bit targets. Ignored by
+		// chunked storage.
+		size_t         maxEntities = EntityTraits::INVALID_INDEX;
+	};
+
+	template <auto OPTIONS>
+	constexpr RegistryOptions ToRegistryOptions() noexcept {
+		if constexpr (std::is_same_v<std::remove_cv_t<decltype(OPTIONS)>, RegistryOptions>)
+			return OPTIONS;
+		else
+			return RegistryOptions{ .chunkSize = static_cast<size_t>(OPTIONS) };
+	}
+
+	// Heap memory held by a container: bytes allocated, and bytes its current
+	// contents need. The difference is what ShrinkToFit can give back.
+	struct Footprint {
+		size_t allocatedBytes = 0;
+		size_t usedBytes      = 0;
+
+		[[nodiscard]] constexpr size_t ReclaimableBytes() const noexcept { return allocatedBytes - usedBytes; }
+
+		constexpr Footprint& operator+=(const Footprint& other) noexcept {
+			allocatedBytes += other.allocatedBytes;
+			usedBytes      += other.usedBytes;
+			return *this;
+		}
+	};
+
+	// Footprint of a vector, ChunkedArray or SplitColumns of which the first
+	// usedCount elements are needed.
+	template <typename Column>
+	[[nodiscard]] Footprint ColumnFootprint(const Column& column, size_t usedCount) noexcept {
+		if constexpr (requires { Column::FieldCount; }) {
+			Footprint f;
+			[&]<size_t... Is>(std::index_sequence<Is...>) {
+				((f += ColumnFootprint(column.template Field<Is>(), usedCount)), ...);
+			}(std::make_index_sequence<Column::FieldCount>{});
+			return f;
+		} else if constexpr (requires { Column::LanesPerWord; }) {
+			return ColumnFootprint(column.Words(), (usedCount + Column::LanesPerWord - 1) / Column::LanesPerWord);
+		} else if constexpr (requires { column.capacity(); }) {
+			using U = typename Column::value_type;
+			return { column.capacity() * sizeof(U), std::min(usedCount, column.size()) * sizeof(U) };
+		} else {
+			return {};
+		}
+	}
+
+	// Memory counters of one column, see Registry::MemoryStats(). Footprints
+	// count the live entities' share as used.
+	struct ColumnMemoryStats {
+		Footprint data;             // component values
+		Footprint sparse;           // entity index -> slot (packed and stable columns)
+		Footprint reverse;          // slot -> entity (packed and stable columns)
+		Footprint tombstones;       // live bitmap and free slots (StableAddresses)
+		Footprint index;            // secondary key indices (IndexKey, OrderKey)
+		size_t chunkCount     = 0;  // allocated data chunks, summed over fields
+		size_t liveChunkCount = 0;  // data chunks holding at least one slot
+		size_t freeSlots      = 0;  // tombstones awaiting reuse (StableAddresses)
+
+		[[nodiscard]] Footprint Total() const noexcept {
+			Footprint f = data;
+			f += sparse;
+			f += reverse;
+			f += tombstones;
+			f += index;
+			return f;
+		}
+	};
+
+	// Adds the chunk counts of a ChunkedArray or SplitColumns; vectors have none.
+	template <typename Column>
+	void AddChunkCounts(ColumnMemoryStats& stats, const Column& column) noexcept {
+		if constexpr (requires { Column::FieldCount; }) {
+			[&]<size_t... Is>(std::index_sequence<Is...>) {
+				(AddChunkCounts(stats, column.template Field<Is>()), ...);
+			}(std::make_index_sequence<Column::FieldCount>{});
+		} else if constexpr (requires { Column::LanesPerWord; }) {
+			AddChunkCounts(stats, column.Words());
+		} else if constexpr (requires { column.memory_stats(); }) {
+			const ChunkedArrayStats chunked = column.memory_stats();
+			stats.chunkCount     += chunked.chunk_count;
+			stats.liveChunkCount += chunked.live_chunk_count;
+		}
+	}
+
+	// Result of Registry::MemoryStats(): the entity bookkeeping plus one entry
+	// per component, in Registry template argument order.
+	template <size_t N>
+	struct RegistryMemoryStats {
+		Footprint entities;         // entity array, alive bitmap, free index set
+		size_t liveEntities   = 0;
+		size_t freeListLength = 0;  // destroyed indices awaiting reuse
+		std::array<ColumnMemoryStats, N> columns{};
+
+		[[nodiscard]] Footprint Total() const noexcept {
+			Footprint f = entities;
+			for (const ColumnMemoryStats& column : columns)
+				f += column.Total();
+			return f;
+		}
+	};
+
+	// Free entity indices for FreeListPolicy::LowestIndex: one bit per index,
+	// plus one summary bit per non-empty word so that the next free index is
+	// found by scanning a word per 4096 indices.
+	class FreeIndexSet {
+	public:
+		// Makes room for `index`; the only member that allocates.
+		void Reserve(size_t index) {
+			if (words.size() <= index / 64) words.resize(index / 64 + 1);
+			if (summary.size() <= index / 4096) summary.resize(index / 4096 + 1);
+		}
+
+		void Insert(size_t index) noexcept {
+			words[index / 64] |= uint64_t{ 1 } << (index % 64);
+			summary[index / 4096] |= uint64_t{ 1 } << (index / 64 % 64);
+		}
+
+		void Erase(size_t index) noexcept {
+			uint64_t& word = words[index / 64];
+			word &= ~(uint64_t{ 1 } << (index % 64));
+			if (word == 0)
+				summary[index / 4096] &= ~(uint64_t{ 1 } << (index / 64 % 64));
+		}
+
+		// Lowest free index >= from, or INVALID_INDEX.
+		[[nodiscard]] uint32_t FindFrom(size_t from) const noexcept {
+			size_t w = from / 64;
+			if (w >= words.size()) return EntityTraits::INVALID_INDEX;
+			if (const uint64_t bits = words[w] & (~uint64_t{ 0 } << (from % 64)))
+				return static_cast<uint32_t>(w * 64 + std::countr_zero(bits));
+			++w;
+			for (size_t s = w / 64; s < summary.size(); ++s) {
+				uint64_t bits = summary[s];
+				if (s == w / 64) bits &= (w % 64 == 0) ? ~uint64_t{ 0 } : ~uint64_t{ 0 } << (w % 64);
+				if (bits != 0) {
+					const size_t word = s * 64 + std::countr_zero(bits);
+					return static_cast<uint32_t>(word * 64 + std::countr_zero(words[word]));
+				}
+			}
+			return EntityTraits::INVALID_INDEX;
+		}
+
+		void clear() noexcept {
+			words.clear();
+			summary.clear();
+		}
+
+		// Forgets every index >= count and releases the memory above it.
+		void Truncate(size_t count) noexcept {
+			words.resize((count + 63) / 64);
+			if (count % 64 != 0)
+				words.back() &= (uint64_t{ 1 } << (count % 64)) - 1;
+			summary.assign((words.size() + 63) / 64, 0);
+			for (size_t w = 0; w < words.size(); ++w)
+				if (words[w] != 0) summary[w / 64] |= uint64_t{ 1 } << (w % 64);
+			words.shrink_to_fit();
+			summary.shrink_to_fit();
+		}
+
+		[[nodiscard]] Footprint MemoryFootprint(size_t indexCount) const noexcept {
+			Footprint f = ColumnFootprint(words, (indexCount + 63) / 64);
+			f += ColumnFootprint(summary, (indexCount + 4095) / 4096);
+			return f;
+		}
+
+	private:
+		std::vector<uint64_t> words;
+		std::vector<uint64_t> summary;
+	};
+
+	// -------------------------------------------------------------------------
+	// Secondary key indices
+	//
+	// Map a key projected from a component to the entities holding that key:
+	// UserConfig<T>::IndexKey through a hash table for exact lookups,
+	// UserConfig<T>::OrderKey through a sorted table for range scans.
+	//
+	// KeyIndex does the bookkeeping both share. Entities are tracked by
+	// entity index, and each remembers the key it is indexed under: Set and
+	// destroy unlink it without looking at the old value. Writes through
+	// references (mutable Get / TryGet / Each / spans) only flag the entity,
+	// or the whole column, as dirty; Refresh() re-keys what was flagged. The
+	// key of a default-constructed T means "unset" and is never indexed, so
+	// CreateEntity does no table work and fresh entities do not collide in a
+	// unique index.
+	// -------------------------------------------------------------------------
+	template <typename T>
+	concept HasIndexKey = requires(const T& t) {
+		{ UserConfig<T>::IndexKey(t) } -> std::equality_comparable;
+	};
+
+	template <typename T>
+	concept HasUniqueIndex = HasIndexKey<T> && requires { requires static_cast<bool>(UserConfig<T>::UniqueIndex); };
+
+	template <typename T>
+	concept HasOrderKey = requires(const T& t) {
+		{ UserConfig<T>::OrderKey(t) } -> std::totally_ordered;
+	};
+
+	template <typename T>
+	using IndexKeyType = std::remove_cvref_t<decltype(UserConfig<T>::IndexKey(std::declval<const T&>()))>;
+
+	template <typename T>
+	using OrderKeyType = std::remove_cvref_t<decltype(UserConfig<T>::OrderKey(std::declval<const T&>()))>;
+
+	// Calls fn(args...) and tells a loop whether to go on: fn may return
+	// false to stop early, or nothing.
+	template <typename Fn, typename... Args>
+	FORCE_INLINE bool InvokeContinue(Fn& fn, Args&&... args) {
+		if constexpr (std::is_same_v<std::invoke_result_t<Fn&, Args...>, bool>) {
+			return std::invoke(fn, std::forward<Args>(args)...);
+		} else {
+			std::invoke(fn, std::forward<Args>(args)...);
+			return true;
+		}
+	}
+
+	// Open-addressing table from key to entity indices: linear probing,
+	// power-of-two capacity, backward-shift deletion, at most 3/4 full. Each
+	// distinct key occupies one bucket; without UNIQUE, the entity indices
+	// sharing it are chained through per-index links, so linking and
+	// unlinking are O(1) either way.
+	template <typename Key, bool UNIQUE>
+	class HashKeyTable {
+	public:
+		static constexpr bool Unique = UNIQUE;
+		static constexpr uint32_t NoLink = std::numeric_limits<uint32_t>::max();
+		static_assert(requires(const Key& k) { { std::hash<Key>{}(k) } -> std::convertible_to<size_t>; },
+			"IndexKey must return a key with a std::hash specialization");
+
+		// Makes room for entity indices below indexCount.
+		void Grow(size_t indexCount) {
+			if constexpr (!Unique) {
+				if (links.size() < indexCount) links.resize(indexCount);
+			}
+		}
+
+		// Indexes i, currently unlinked, under key. Throws before changing
+		// anything if the table cannot grow.
+		void Link(uint32_t i, const Key& key) {
+			Reserve();
+			const size_t mask = buckets.size() - 1;
+			size_t b = Home(key);
+			for (; buckets[b].head != NoLink; b = (b + 1) & mask) {
+				if (!(buckets[b].key == key)) continue;
+				if constexpr (!Unique) {
+					links[i].next = buckets[b].head;
+					links[buckets[b].head].prev = i;
+				}
+				buckets[b].head = i;
+				return;
+			}
+			buckets[b].key = key;
+			buckets[b].head = i;
+			++used;
+		}
+
+		void Unlink(uint32_t i, const Key& key) noexcept {
+			if constexpr (!Unique) {
+				const uint32_t prev = std::exchange(links[i].prev, NoLink);
+				const uint32_t next = std::exchange(links[i].next, NoLink);
+				if (next != NoLink) links[next].prev = prev;
+				if (prev != NoLink) {
+					links[prev].next = next;
+					return;
+				}
+				if (next != NoLink) {
+					buckets[FindBucket(key)].head = next;
+					return;
+				}
+			}
+			EraseBucket(FindBucket(key));
+		}
+
+		[[nodiscard]] bool Contains(const Key& key) const noexcept {
+			return FindBucket(key) != NoBucket;
+		}
+
+		// Calls fn(index) for each entity index under key, the most recently
+		// linked first, until fn returns false.
+		template <typename Fn>
+		void ForEach(const Key& key, Fn&& fn) const {
+			const size_t b = FindBucket(key);
+			if (b == NoBucket) return;
+			for (uint32_t i = buckets[b].head; i != NoLink;) {
+				const uint32_t next = Unique ? NoLink : links[i].next;
+				if (!InvokeContinue(fn, i)) return;
+				i = next;
+			}
+		}
+
+		void Clear() noexcept {
+			buckets.clear();
+			links.clear();
+			used = 0;
+			shift = 64;
+		}
+
+		void ShrinkToFit(size_t indexCount) noexcept {
+			if (links.size() > indexCount) links.resize(indexCount);
+			links.shrink_to_fit();
+		}
+
+		[[nodiscard]] Footprint MemoryFootprint() const noexcept {
+			Footprint f = ColumnFootprint(buckets, buckets.size());
+			f += ColumnFootprint(links, links.size());
+			return f;
+		}
+
+	private:
+		static constexpr size_t NoBucket = std::numeric_limits<size_t>::max();
+		static constexpr size_t MinBuckets = 16;
+
+		struct Bucket {
+			Key      key{};
+			uint32_t head = NoLink;  // first entity index under key; NoLink: empty
+		};
+
+		struct Links {
+			uint32_t prev = NoLink;
+			uint32_t next = NoLink;
+		};
+
+		[[nodiscard]] FORCE_INLINE size_t Home(const Key& key) const noexcept {
+			// Fibonacci hashing, so that identity hashes of integers spread out.
+			return static_cast<size_t>((static_cast<uint64_t>(std::hash<Key>{}(key)) * 0x9E3779B97F4A7C15ull) >> shift);
+		}
+
+		[[nodiscard]] size_t FindBucket(const Key& key) const noexcept {
+			if (used == 0) return NoBucket;
+			const size_t mask = buckets.size() - 1;
+			for (size_t b = Home(key); buckets[b].head != NoLink; b = (b + 1) & mask)
+				if (buckets[b].key == key) return b;
+			return NoBucket;
+		}
+
+		// Makes room for one more bucket.
+		void Reserve() {
+			if ((used + 1) * 4 <= buckets.size() * 3) return;
+			const size_t capacity = std::max(MinBuckets, buckets.size() * 2);
+			std::vector<Bucket> old = std::exchange(buckets, std::vector<Bucket>(capacity));
+			shift = 64 - static_cast<unsigned>(std::countr_zero(capacity));
+			for (Bucket& bucket : old) {
+				if (bucket.head == NoLink) continue;
+				size_t b = Home(bucket.key);
+				while (buckets[b].head != NoLink) b = (b + 1) & (capacity - 1);
+				buckets[b] = std::move(bucket);
+			}
+		}
+
+		// Backward-shift deletion: entries after the hole move back into it
+		// unless that would put them before their home bucket.
+		void EraseBucket(size_t hole) noexcept {
+			const size_t mask = buckets.size() - 1;
+			for (size_t b = (hole + 1) & mask; buckets[b].head != NoLink; b = (b + 1) & mask) {
+				if (((b - Home(buckets[b].key)) & mask) >= ((b - hole) & mask)) {
+					buckets[hole] = std::move(buckets[b]);
+					hole = b;
+				}
+			}
+			buckets[hole] = Bucket{};
+			--used;
+		}
+
+		std::vector<Bucket> buckets;
+		std::vector<Links>  links;  // by entity index, multi-value only
+		size_t   used = 0;
+		unsigned shift = 64;
+	};
+
+	// (key, entity index) pairs sorted by key, then index, in an
+	// OrderedChunkedArray: a binary search over the chunks' last entries
+	// finds a key, inserts and erases shift one chunk, and a range is
+	// walked chunk by chunk.
+	template <typename Key>
+	class OrderedKeyTable {
+	public:
+		static constexpr bool Unique = false;
+
+		OrderedKeyTable() = default;
+		OrderedKeyTable(const OrderedKeyTable& other) : entries(other.entries.clone()) {}
+		OrderedKeyTable(OrderedKeyTable&&) noexcept = default;
+		OrderedKeyTable& operator=(const OrderedKeyTable& other) {
+			entries = other.entries.clone();
+			return *this;
+		}
+		OrderedKeyTable& operator=(OrderedKeyTable&&) noexcept = default;
+
+		constexpr void Grow(size_t) noexcept {}
+
+		void Link(uint32_t i, const Key& key) {
+			entries.insert_sorted(Entry{ key, i }, EntryLess{});
+		}
+
+		void Unlink(uint32_t i, const Key& key) noexcept {
+			const size_t pos = entries.lower_bound(Entry{ key, i }, EntryLess{});
+			assert(pos < entries.size() && entries[pos].index == i);
+			entries.erase(pos);
+		}
+
+		// Calls fn(index) for each entity index with *lo <= key < *hi (a null
+		// bound is open), in ascending key order or descending with REVERSE,
+		// until fn returns false.
+		template <bool REVERSE, typename Fn>
+		void ForEachInRange(const Key* lo, const Key* hi, Fn&& fn) const {
+			if (lo && hi && !(*lo < *hi)) return;
+			if constexpr (!REVERSE) {
+				auto it = lo ? entries.nth(entries.lower_bound(*lo, KeyLess{})) : entries.begin();
+				for (; it != entries.end() && (!hi || it->key < *hi); ++it)
+					if (!InvokeContinue(fn, it->index)) return;
+			} else {
+				auto it = hi ? entries.nth(entries.lower_bound(*hi, KeyLess{})) : entries.end();
+				while (it != entries.begin()) {
+					--it;
+					if ((lo && it->key < *lo) || !InvokeContinue(fn, it->index)) return;
+				}
+			}
+		}
+
+		void Clear() noexcept { entries.clear(); }
+		constexpr void ShrinkToFit(size_t) noexcept {}
+
+		[[nodiscard]] Footprint MemoryFootprint() const noexcept {
+			const ChunkedArrayStats stats = entries.memory_stats();
+			return { stats.allocated_bytes + stats.index_bytes, stats.live_bytes + stats.index_bytes };
+		}
+
+	private:
+		struct Entry {
+			Key      key;
+			uint32_t index;
+		};
+
+		struct EntryLess {
+			bool operator()(const Entry& a, const Entry& b) const noexcept {
+				return a.key < b.key || (!(b.key < a.key) && a.index < b.index);
+			}
+		};
+
+		struct KeyLess {
+			bool operator()(const Entry& a, const Key& b) const noexcept { return a.key < b; }
+		};
+
+		OrderedChunkedArray<Entry> entries;
+	};
+
+	template <typename T>
+	struct IndexKeyOf {
+		constexpr auto operator()(const T& value) const { return UserConfig<T>::IndexKey(value); }
+	};
+
+	template <typename T>
+	struct OrderKeyOf {
+		constexpr auto operator()(const T& value) const { return UserConfig<T>::OrderKey(value); }
+	};
+
+	// Per-entity-index bookkeeping over a key table; Proj projects a T to its
+	// key (IndexKeyOf / OrderKeyOf).
+	template <typename T, typename Proj, typename Table>
+	class KeyIndex {
+	public:
+		using KeyType = std::remove_cvref_t<std::invoke_result_t<Proj, const T&>>;
+		using Projection = Proj;
+		static constexpr bool Unique = Table::Unique;
+		static_assert(std::is_default_constructible_v<KeyType> && std::is_copy_assignable_v<KeyType>,
+			"Index keys must be default-constructible and copyable");
+
+		KeyIndex()
+			: unsetKey(Proj{}(T{}))
+		{}
+
+		// Entity index i became live, holding a default-valued component.
+		void Insert(uint32_t i, Entity entity) {
+			if (records.size() <= i) {
+				table.Grow(static_cast<size_t>(i) + 1);
+				records.resize(static_cast<size_t>(i) + 1);
+				// MarkDirty never allocates: the list can hold every index.
+				dirtyList.reserve(records.capacity());
+			}
+			records[i].key = unsetKey;
+			records[i].entity = entity;
+		}
+
+		void Erase(uint32_t i) noexcept {
+			Unlink(i);
+			records[i].entity = NullEntity;
+		}
+
+		// Re-keys entity index i for a Set. Call Refresh() first so that the
+		// clash check sees current keys. Throws std::runtime_error, leaving
+		// the index unchanged, if a unique index maps key to another entity.
+		void Update(uint32_t i, const KeyType& key) {
+			if (key == records[i].key) return;
+			if constexpr (Unique) {
+				if (!(key == unsetKey) && table.Contains(key))
+					throw std::runtime_error("Duplicate key in unique index");
+			}
+			Unlink(i);
+			try {
+				Link(i, key);
+			} catch (...) {
+				// i is unindexed now; the rescan puts it back under its key.
+				allDirty = true;
+				throw;
+			}
+		}
+
+		FORCE_INLINE void MarkDirty(uint32_t i) noexcept {
+			Record& r = records[i];
+			if (r.dirty || allDirty) return;
+			// Only a copied index can run out of room; rescan it whole instead.
+			if (dirtyList.size() == dirtyList.capacity()) {
+				allDirty = true;
+				return;
+			}
+			r.dirty = true;
+			dirtyList.push_back(i);
+		}
+
+		void MarkAllDirty() noexcept { allDirty = true; }
+
+		[[nodiscard]] bool IsClean() const noexcept { return !allDirty && dirtyList.empty(); }
+
+		// Re-keys the entities flagged since the last call; keyOf(i) returns
+		// the current key of live entity index i. Changed entities are all
+		// unlinked before any is linked again, so keys swapped between
+		// entities do not clash. A unique key that two entities were given
+		// through references stays with the one linked first; the other stays
+		// flagged, so the index reads as stale (const lookups scan) and it is
+		// linked by the first Refresh after the key is free again.
+		template <typename KeyOf>
+		void Refresh(KeyOf&& keyOf) {
+			if (IsClean()) return;
+			dirtyList.reserve(records.capacity());
+			std::vector<std::pair<uint32_t, KeyType>> changed;
+			const auto collect = [&](uint32_t i) {
+				if (IsNullEntity(records[i].entity)) return;
+				KeyType key = keyOf(i);
+				if (!(key == records[i].key)) changed.emplace_back(i, std::move(key));
+			};
+			if (allDirty) {
+				for (uint32_t i = 0; i < records.size(); ++i) collect(i);
+			} else {
+				for (const uint32_t i : dirtyList) collect(i);
+			}
+			for (const auto& [i, key] : changed)
+				Unlink(i);
+			for (const uint32_t i : dirtyList) records[i].dirty = false;
+			dirtyList.clear();
+			allDirty = true;  // until every changed entity is linked again
+			for (const auto& [i, key] : changed) {
+				if constexpr (Unique) {
+					if (table.Contains(key)) {
+						records[i].dirty = true;
+						dirtyList.push_back(i);
+						continue;
+					}
+				}
+				Link(i, key);
+			}
+			allDirty = false;
+		}
+
+		// Entity owning a live entity index the table handed out.
+		[[nodiscard]] FORCE_INLINE Entity EntityAt(uint32_t i) const noexcept { return records[i].entity; }
+
+		[[nodiscard]] const Table& Lookup() const noexcept { return table; }
+
+		[[nodiscard]] const KeyType& UnsetKey() const noexcept { return unsetKey; }
+
+		void Clear() noexcept {
+			records.clear();
+			dirtyList.clear();
+			table.Clear();
+			allDirty = false;
+		}
+
+		// Drops the records of indices >= indexCount, all of them dead.
+		void ShrinkToFit(size_t indexCount) noexcept {
+			if (records.size() > indexCount) records.resize(indexCount);
+			std::erase_if(dirtyList, [indexCount](uint32_t i) { return i >= indexCount; });
+			records.shrink_to_fit();
+			table.ShrinkToFit(indexCount);
+		}
+
+		[[nodiscard]] Footprint MemoryFootprint() const noexcept {
+			Footprint f = ColumnFootprint(records, records.size());
+			f += ColumnFootprint(dirtyList, dirtyList.size());
+			f += table.MemoryFootprint();
+			return f;
+		}
+
+	private:
+		struct Record {
+			KeyType key{};               // key the entity is indexed under
+			Entity  entity = NullEntity;  // NullEntity while the index is dead
+			bool    dirty = false;
+		};
+
+		// Indexes entity index i, currently unlinked, under key.
+		void Link(uint32_t i, const KeyType& key) {
+			if (key == unsetKey) return;
+			table.Link(i, key);
+			records[i].key = key;
+		}
+
+		void Unlink(uint32_t i) noexcept {
+			Record& r = records[i];
+			if (r.key == unsetKey) return;
+			table.Unlink(i, r.key);
+			r.key = unsetKey;
+		}
+
+		std::vector<Record>   records;    // by entity index
+		std::vector<uint32_t> dirtyList;  // flagged entity indices
+		Table    table;
+		KeyType  unsetKey;
+		bool     allDirty = false;
+	};
+
+	template <typename T>
+	struct HashKeyIndexOf {
+		using type = KeyIndex<T, IndexKeyOf<T>, HashKeyTable<IndexKeyType<T>, HasUniqueIndex<T>>>;
+	};
+
+	template <typename T>
+	struct OrderedKeyIndexOf {
+		using type = KeyIndex<T, OrderKeyOf<T>, OrderedKeyTable<OrderKeyType<T>>>;
+	};
+
+	struct NoKeyIndex {
+		FORCE_INLINE constexpr void Insert(uint32_t, Entity) noexcept {}
+		FORCE_INLINE constexpr void Erase(uint32_t) noexcept {}
+		FORCE_INLINE constexpr void MarkDirty(uint32_t) noexcept {}
+		FORCE_INLINE constexpr void MarkAllDirty() noexcept {}
+		constexpr void Clear() noexcept {}
+		constexpr void ShrinkToFit(size_t) noexcept {}
+		[[nodiscard]] constexpr Footprint MemoryFootprint() const noexcept { return {}; }
+	};
+
+	// Placeholder for the index maps a layout does not need.
+	struct NoIndexStorage {
+		constexpr void clear() noexcept {}
+	};
+
+	template <auto CHUNK_SIZE = DEFAULT_DENSE_CHUNK_SIZE, typename... Cs>
+	class Registry;
+
+	template <typename TypedRegistry, typename T>
+	class ComponentStorage {
+	public:
+		template<auto CHUNK_SIZE2, typename... Cs2>
+		friend class Registry;
+
+		using MyStoredType = T;
+		using IndexType = Entity::IdType;
+		static constexpr size_t CHUNK_SIZE = TypedRegistry::ChunkSize;
+		static constexpr bool IsContiguous = TypedRegistry::IsContiguous;
+		static constexpr bool IsDirect = TypedRegistry::IsDirect;
+		static constexpr bool IsStable = HasStableAddresses<T> && !IsDirect;
+		// Whether dead entities leave holes that iteration must skip.
+		static constexpr bool HasHoles = IsDirect || IsStable;
+		// Columns with equal SlotSpace place a given entity at the same slot.
+		static constexpr int SlotSpace = IsDirect ? 0 : (IsStable ? 1 : 2);
+		// Chunk size of the data column; index maps keep the registry's. Columns
+		// with holes keep whole 64-slot bitmap words per chunk.
+		static constexpr size_t DataChunkSize = ComponentChunkSize<T, CHUNK_SIZE, HasHoles ? 64 : 1>();
+		static constexpr bool CopyOnWrite = TypedRegistry::CopyOnWrite;
+		template <typename U>
+		using ColumnOf = std::conditional_t<IsContiguous, typename TypedRegistry::template ContiguousArray<U>,
+			ChunkedArray<U, CHUNK_SIZE, DEFAULT_CHUNK_ALIGN, false, CopyOnWrite>>;
+		template <typename U>
+		using DataColumnOf = std::conditional_t<IsContiguous, typename TypedRegistry::template ContiguousArray<U>,
+			ChunkedArray<U, DataChunkSize, DEFAULT_CHUNK_ALIGN, false, CopyOnWrite>>;
+		static constexpr bool IsSplit = SplitsFields<T>;
+		static constexpr bool IsPacked = HasPackedBits<T>;
+		// Components without a span of T: accessed through proxies only.
+		static constexpr bool IsProxied = IsSplit || IsPacked;
+		using DataStorage = std::conditional_t<IsSplit, SplitColumns<T, DataColumnOf>,
+			std::conditional_t<IsPacked, typename PackedColumnOf<T, DataColumnOf>::type, DataColumnOf<T>>>;
+		using EntityStorage = std::conditional_t<IsDirect, NoIndexStorage, ColumnOf<Entity>>;
+		using SparseStorage = std::conditional_t<IsDirect, NoIndexStorage, ColumnOf<uint32_t>>;
+		// Granularity of GetDataSpans() and of chunk summaries; contiguous storage
+		// emulates chunks of DEFAULT_DENSE_CHUNK_SIZE.
+		static constexpr size_t SpanSize = IsContiguous ? DEFAULT_DENSE_CHUNK_SIZE : DataChunkSize;
+		static constexpr bool HasSummaries = HasSummaryKey<T>;
+		static_assert(!(IsSplit && HasSummaries), "SplitFields and SummaryKey cannot be combined");
+		static_assert(!IsStable || !IsContiguous, "StableAddresses requires chunked storage (CHUNK_SIZE > 0)");
+		static_assert(!(IsStable && IsSplit), "SplitFields and StableAddresses cannot be combined");
+		static_assert(!(IsPacked && (IsSplit || IsStable || HasSummaries)),
+			"PackedBits cannot be combined with SplitFields, StableAddresses or SummaryKey");
+		static_assert(!CopyOnWrite || (!IsContiguous && !IsStable && std::is_trivially_copyable_v<T>),
+			"copyOnWrite requires chunked storage and trivially copyable components without StableAddresses");
+		using TombstoneStorage = std::conditional_t<IsStable, SlotTombstones, NoIndexStorage>;
+		using SummaryStorage = std::conditional_t<HasSummaries, ColumnSummaries<T, SpanSize>, NoColumnSummaries>;
+		static constexpr bool HasIndex = HasIndexKey<T>;
+		static constexpr bool HasOrder = HasOrderKey<T>;
+		using IndexStorage = typename std::conditional_t<HasIndex, HashKeyIndexOf<T>, std::type_identity<NoKeyIndex>>::type;
+		using OrderStorage = typename std::conditional_t<HasOrder, OrderedKeyIndexOf<T>, std::type_identity<NoKeyIndex>>::type;
+
+		explicit ComponentStorage(TypedRegistry& r)
+			: regPtr(&r)
+		{}
+
+	private:
+		void Init(IndexType entityIndex, Entity entity) {
+			const AccessGuard<true> guard(access);
+			Emplace(entityIndex, entity);
+		}
+
+		// Deep copy of another registry's column (see Registry::Clone). Slots,
+		// index maps, tombstones and summaries are reproduced exactly; regPtr
+		// keeps pointing at this column's own registry.
+		void CopyFrom(const ComponentStorage& src) {
+			const AccessGuard<false> guard(src.access);
+			data         = CloneColumn(src.data);
+			slotToEntity = CloneColumn(src.slotToEntity);
+			indexToSlot  = CloneColumn(src.indexToSlot);
+			tombstones   = src.tombstones;
+			summaries    = src.summaries;
+			index        = src.index;
+			order        = src.order;
+		}
+
+		// Copy-on-write counterpart of CopyFrom (see Registry::Fork): the chunks
+		// become shared with src, which is why src is written to.
+		void ForkFrom(ComponentStorage& src) {
+			const AccessGuard<true> guard(src.access);
+			data         = ForkColumn(src.data);
+			slotToEntity = ForkColumn(src.slotToEntity);
+			indexToSlot  = ForkColumn(src.indexToSlot);
+			summaries    = src.summaries;
+			index        = src.index;
+			order        = src.order;
+		}
+
+		void Kill(IndexType entityIndex) {
+			const AccessGuard<true> guard(access);
+			Remove(entityIndex);
+		}
+
+		// Bulk forms of Init / Kill, holding the column's write guard once.
+		void InitMany(std::span<const Entity> batch) {
+			const AccessGuard<true> guard(access);
+			if constexpr (!IsDirect && requires { data.reserve(size_t{}); }) {
+				data.reserve(data.size() + batch.size());
+				slotToEntity.reserve(slotToEntity.size() + batch.size());
+			}
+			for (const Entity e : batch)
+				Emplace(EntityToIndex(e), e);
+		}
+
+		void KillMany(std::span<const IndexType> indices) {
+			const AccessGuard<true> guard(access);
+			for (const IndexType i : indices)
+				Remove(i);
+		}
+
+		void Emplace(IndexType entityIndex, Entity entity) {
+			if constexpr (IsDirect) {
+				// A recycled index still holds the default value Remove left
+				// behind; a fresh one is appended.
+				while (data.size() <= entityIndex)
+					data.emplace_back();
+				summaries.MarkDirty(entityIndex);
+				index.Insert(entityIndex, entity);
+				order.Insert(entityIndex, entity);
+			} else {
+				size_t slot = data.size();
+				if constexpr (IsStable) {
+					// Reuse a tombstone when there is one; it holds a default value.
+					if (!tombstones.freeSlots.empty())
+						slot = tombstones.freeSlots.back();
+					if (tombstones.live.size() <= slot / 64)
+						tombstones.live.push_back(0);
+					if (slot != data.size()) {
+						tombstones.freeSlots.pop_back();
+						slotToEntity[slot] = entity;
+					}
+				}
+				if (slot == data.size()) {
+					data.emplace_back();
+					slotToEntity.emplace_back(entity);
+				}
+				EnsureSparseSlot(entityIndex);
+				indexToSlot[entityIndex] = static_cast<uint32_t>(slot);
+				if constexpr (IsStable)
+					tombstones.live[slot / 64] |= uint64_t{ 1 } << (slot % 64);
+				summaries.MarkDirty(slot);
+				index.Insert(entityIndex, entity);
+				order.Insert(entityIndex, entity);
+			}
+		}
+
+		void Remove(IndexType entityIndex) {
+			index.Erase(entityIndex);
+			order.Erase(entityIndex);
+			if constexpr (IsDirect) {
+				// Leave a default-constructed hole, releasing what the component owned.
+				data[entityIndex] = MyStoredType{};
+				summaries.MarkDirty(entityIndex);
+			} else if constexpr (IsStable) {
+				const size_t slot = indexToSlot[entityIndex];
+				tombstones.freeSlots.push_back(static_cast<uint32_t>(slot));
+				tombstones.live[slot / 64] &= ~(uint64_t{ 1 } << (slot % 64));
+				data[slot] = MyStoredType{};
+				slotToEntity[slot] = NullEntity;
+				summaries.MarkDirty(slot);
+			} else {
+				const size_t slot = indexToSlot[entityIndex];
+				const size_t last = data.size() - 1;
+
+				if (slot != last) {
+					MoveColumnElement(data, slot, last);
+					const Entity movedEntity = slotToEntity[last];
+					slotToEntity[slot] = movedEntity;
+					indexToSlot[EntityToIndex(movedEntity)] = static_cast<uint32_t>(slot);
+					summaries.MarkDirty(slot);
+				}
+
+				data.pop_back();
+				slotToEntity.pop_back();
+			}
+		}
+
+		// Unchecked - caller guarantees entity is live.
+		template<typename... Args>
+		void Set(IndexType entityIndex, Args&&... args) {
+			const AccessGuard<true> guard(access);
+			const size_t slot = SlotOf(entityIndex);
+			if constexpr (HasIndex || HasOrder) {
+				// Re-key before writing: a unique-key clash leaves the component as it was.
+				MyStoredType value{ std::forward<Args>(args)... };
+				UpdateKeys(entityIndex, value);
+				data[slot] = std::move(value);
+			} else {
+				data[slot] = MyStoredType{ std::forward<Args>(args)... };
+			}
+			summaries.MarkDirty(slot);
+		}
+
+		// Unchecked - caller guarantees entity is live.
+		[[nodiscard]] decltype(auto) Get(IndexType entityIndex) {
+			const size_t slot = SlotOf(entityIndex);
+			summaries.MarkDirty(slot);
+			index.MarkDirty(entityIndex);
+			order.MarkDirty(entityIndex);
+			return data[slot];
+		}
+
+		[[nodiscard]] decltype(auto) Get(IndexType entityIndex) const {
+			return data[SlotOf(entityIndex)];
+		}
+
+		[[nodiscard]] decltype(auto) GetByDenseSlotUnchecked(size_t slot) {
+			return data[slot];
+		}
+
+		[[nodiscard]] decltype(auto) GetByDenseSlotUnchecked(size_t slot) const {
+			return data[slot];
+		}
+
+		[[nodiscard]] MyStoredType* TryGet(IndexType entityIndex) noexcept {
+			static_assert(!IsProxied, "TryGet is unavailable for SplitFields / PackedBits components; use Get");
+			const size_t slot = SlotOf(entityIndex);
+			summaries.MarkDirty(slot);
+			index.MarkDirty(entityIndex);
+			order.MarkDirty(entityIndex);
+			return &data[slot];
+		}
+
+		[[nodiscard]] const MyStoredType* TryGet(IndexType entityIndex) const noexcept {
+			static_assert(!IsProxied, "TryGet is unavailable for SplitFields / PackedBits components; use Get");
+			return &data[SlotOf(entityIndex)];
+		}
+
+		// Bitmap of live slots of a column with holes: the registry's alive
+		// bitmap in the direct layout, the column's own for StableAddresses.
+		[[nodiscard]] std::span<const uint64_t> LiveMask() const noexcept
+			requires HasHoles
+		{
+			if constexpr (IsDirect) return regPtr->alive;
+			else return tombstones.live;
+		}
+
+		// Live entities whose packed component equals value. Direct-layout
+		// holes hold T{} and are discounted without visiting them.
+		[[nodiscard]] size_t CountEqual(MyStoredType value) const noexcept
+			requires IsPacked
+		{
+			size_t n = data.CountEqual(value);
+			if constexpr (IsDirect) {
+				if (value == MyStoredType{}) n -= data.size() - regPtr->Size();
+			}
+			return n;
+		}
+
+		// Calls fn(slot) for every live slot in [lo, hi).
+		template <typename Fn>
+		FORCE_INLINE void ForEachLiveSlot(size_t lo, size_t hi, Fn&& fn) const {
+			if constexpr (HasHoles) ForEachSetBit(LiveMask(), lo, hi, fn);
+			else for (size_t i = lo; i < hi; ++i) fn(i);
+		}
+
+		// Entity index owning a live slot.
+		[[nodiscard]] FORCE_INLINE IndexType IndexAtSlot(size_t slot) const noexcept {
+			if constexpr (IsDirect) return static_cast<IndexType>(slot);
+			else return EntityToIndex(slotToEntity[slot]);
+		}
+
+		// Column slot of a live entity: its index itself in the direct layout.
+		[[nodiscard]] FORCE_INLINE size_t SlotOf(IndexType entityIndex) const noexcept {
+			if constexpr (IsDirect) return entityIndex;
+			else return indexToSlot[entityIndex];
+		}
+
+		// Returns the size of the dense data array (number of components stored,
+		// including holes in the direct layout)
+		[[nodiscard]] size_t DenseSize() const noexcept {
+			return data.size();
+		}
+
+		void Clear() noexcept {
+			const AccessGuard<true> guard(access);
+			data.clear();
+			slotToEntity.clear();
+			indexToSlot.clear();
+			tombstones.clear();
+			summaries.Clear();
+			index.Clear();
+			order.Clear();
+		}
+
+		// Releases spare capacity. indexCount is the registry's entity count
+		// after trimming its free tail; sparse entries beyond it are dropped.
+		void ShrinkToFit(size_t indexCount) noexcept {
+			const AccessGuard<true> guard(access);
+			if constexpr (IsDirect) {
+				while (data.size() > indexCount)
+					data.pop_back();
+			} else {
+				if constexpr (IsStable) {
+					// Trailing tombstones can go; interior ones must stay put.
+					const size_t n = UsedSlots();
+					while (data.size() > n) {
+						data.pop_back();
+						slotToEntity.pop_back();
+					}
+					std::erase_if(tombstones.freeSlots, [n](uint32_t slot) { return slot >= n; });
+					tombstones.live.resize((n + 63) / 64);
+					tombstones.live.shrink_to_fit();
+					tombstones.freeSlots.shrink_to_fit();
+				}
+				if (indexToSlot.size() > indexCount)
+					indexToSlot.resize(indexCount);
+				indexToSlot.shrink_to_fit();
+				slotToEntity.shrink_to_fit();
+			}
+			data.shrink_to_fit();
+			index.ShrinkToFit(indexCount);
+			order.ShrinkToFit(indexCount);
+		}
+
+		// Slots up to and including the last live one.
+		[[nodiscard]] size_t UsedSlots() const noexcept {
+			if constexpr (IsStable) {
+				for (size_t w = tombstones.live.size(); w-- > 0;)
+					if (tombstones.live[w] != 0)
+						return w * 64 + 64 - static_cast<size_t>(std::countl_zero(tombstones.live[w]));
+				return 0;
+			} else {
+				return data.size();
+			}
+		}
+
+		[[nodiscard]] Footprint MemoryFootprint(size_t indexCount) const noexcept {
+			const size_t slots = IsDirect ? std::min(data.size(), indexCount) : UsedSlots();
+			Footprint f = ColumnFootprint(data, slots);
+			f += ColumnFootprint(slotToEntity, slots);
+			f += ColumnFootprint(indexToSlot, indexCount);
+			if constexpr (IsStable) {
+				f += ColumnFootprint(tombstones.live, (slots + 63) / 64);
+				f += ColumnFootprint(tombstones.freeSlots, tombstones.freeSlots.size());
+			}
+			f += index.MemoryFootprint();
+			f += order.MemoryFootprint();
+			return f;
+		}
+
+		// O(1) counterpart of MemoryFootprint; liveCount is the registry's Size().
+		[[nodiscard]] ColumnMemoryStats MemoryStats(size_t liveCount) const noexcept {
+			ColumnMemoryStats stats;
+			stats.data = ColumnFootprint(data, liveCount);
+			if constexpr (!IsDirect)
+				stats.sparse = ColumnFootprint(indexToSlot, indexToSlot.size());
+			stats.reverse = ColumnFootprint(slotToEntity, liveCount);
+			if constexpr (IsStable) {
+				stats.tombstones = ColumnFootprint(tombstones.live, tombstones.live.size());
+				stats.tombstones += ColumnFootprint(tombstones.freeSlots, tombstones.freeSlots.size());
+				stats.freeSlots = tombstones.freeSlots.size();
+			}
+			stats.index = index.MemoryFootprint();
+			stats.index += order.MemoryFootprint();
+			AddChunkCounts(stats, data);
+			return stats;
+		}
+
+		[[nodiscard]] const MyStoredType* GetPointerAt(size_t slot) const noexcept {
+			static_assert(!IsProxied, "GetPointerAt is unavailable for SplitFields / PackedBits components");
+			return &data[slot];
+		}
+
+		// Calls fn(std::span<T>) for each run of live dense slots: one span per
+		// live chunk, or SpanSize-sized slices of the contiguous vector.
+		template <typename Fn>
+		void ForEachSpan(Fn&& fn) {
+			static_assert(!IsProxied, "SplitFields / PackedBits components have no span of T; use field spans / CountEqual");
+			ForEachColumnSpan<SpanSize>(data, fn);
+		}
+
+		template <typename Fn>
+		void ForEachSpan(Fn&& fn) const {
+			static_assert(!IsProxied, "SplitFields / PackedBits components have no span of T; use field spans / CountEqual");
+			ForEachColumnSpan<SpanSize>(data, fn);
+		}
+
+		// Per-member spans of a SplitFields component.
+		template <size_t I, typename Fn>
+		void ForEachFieldSpan(Fn&& fn) {
+			static_assert(IsSplit, "ForEachFieldSpan requires a SplitFields component");
+			MarkAllWritten();
+			ForEachColumnSpan<SpanSize>(data.template Field<I>(), fn);
+		}
+
+		template <size_t I, typename Fn>
+		void ForEachFieldSpan(Fn&& fn) const {
+			static_assert(IsSplit, "ForEachFieldSpan requires a SplitFields component");
+			ForEachColumnSpan<SpanSize>(data.template Field<I>(), fn);
+		}
+
+		// For contiguous storage (VirtualArray), emulates chunks of DEFAULT_DENSE_CHUNK_SIZE.
+		// This ensures consistent chunk-based parallel iteration across all storage types.
+		// Only chunks holding live elements are returned, even if more are allocated.
+		[[nodiscard]] auto GetDataSpans() noexcept {
+			// Spans are writable: assume every element changes.
+			MarkAllWritten();
+			std::vector<std::span<MyStoredType>> result;
+			result.reserve((data.size() + SpanSize - 1) / SpanSize);
+			ForEachSpan([&result](std::span<MyStoredType> s) { result.push_back(s); });
+			return result;
+		}
+
+		[[nodiscard]] auto GetDataSpans() const noexcept {
+			std::vector<std::span<const MyStoredType>> result;
+			result.reserve((data.size() + SpanSize - 1) / SpanSize);
+			ForEachSpan([&result](std::span<const MyStoredType> s) { result.push_back(s); });
+			return result;
+		}
+
+		// Every element may be written through the references handed out.
+		void MarkAllWritten() noexcept {
+			summaries.MarkAllDirty();
+			MarkKeysDirty();
+		}
+
+		void MarkKeysDirty() noexcept {
+			index.MarkAllDirty();
+			order.MarkAllDirty();
+		}
+
+		// Current key, under projection Proj, of the live entity with index
+		// entityIndex.
+		template <typename Proj>
+		[[nodiscard]] auto KeyOf(IndexType entityIndex) const {
+			if constexpr (IsProxied) return Proj{}(static_cast<MyStoredType>(Get(entityIndex)));
+			else return Proj{}(Get(entityIndex));
+		}
+
+		template <typename Keys>
+		void RefreshKeys(Keys& keys) {
+			if constexpr (!std::is_same_v<Keys, NoKeyIndex>)
+				keys.Refresh([this](uint32_t i) { return KeyOf<typename Keys::Projection>(i); });
+		}
+
+		// Re-keys both indices for a Set of value. If either throws, neither
+		// is left out of step with the unchanged component.
+		void UpdateKeys(IndexType entityIndex, const MyStoredType& value) {
+			RefreshKeys(index);
+			RefreshKeys(order);
+			if constexpr (HasIndex)
+				index.Update(entityIndex, IndexKeyOf<T>{}(value));
+			if constexpr (HasOrder) {
+				try {
+					order.Update(entityIndex, OrderKeyOf<T>{}(value));
+				} catch (...) {
+					index.MarkAllDirty();
+					throw;
+				}
+			}
+		}
+
+		// Calls fn(Entity) for each live entity whose IndexKey equals key,
+		// until fn returns false: through the index, or by scanning the
+		// column while it is stale.
+		template <typename Key, typename Fn>
+		void ForEachWithKey(const Key& key, Fn&& fn) const
+			requires HasIndex
+		{
+			if (index.IsClean()) {
+				index.Lookup().ForEach(key, [&](uint32_t i) { return InvokeContinue(fn, index.EntityAt(i)); });
+				return;
+			}
+			if (key == index.UnsetKey()) return;
+			bool more = true;
+			ForEachLiveSlot(0, DenseSize(), [&](size_t slot) {
+				const IndexType i = IndexAtSlot(slot);
+				if (more && KeyOf<IndexKeyOf<T>>(i) == key) more = InvokeContinue(fn, index.EntityAt(i));
+			});
+		}
+
+		// Calls fn(Entity) for each live entity with *lo <= OrderKey < *hi (a
+		// null bound is open) in key order, ties by entity index, until fn
+		// returns false. A stale index is bypassed by sorting the matches of
+		// a column scan.
+		template <bool REVERSE, typename Key, typename Fn>
+		void ForEachInRange(const Key* lo, const Key* hi, Fn&& fn) const
+			requires HasOrder
+		{
+			if (order.IsClean()) {
+				order.Lookup().template ForEachInRange<REVERSE>(lo, hi, [&](uint32_t i) { return InvokeContinue(fn, order.EntityAt(i)); });
+				return;
+			}
+			std::vector<std::pair<Key, IndexType>> matches;
+			ForEachLiveSlot(0, DenseSize(), [&](size_t slot) {
+				const IndexType i = IndexAtSlot(slot);
+				Key key = KeyOf<OrderKeyOf<T>>(i);
+				if (key == order.UnsetKey() || (lo && key < *lo) || (hi && !(key < *hi))) return;
+				matches.emplace_back(std::move(key), i);
+			});
+			std::sort(matches.begin(), matches.end());
+			if constexpr (REVERSE) std::reverse(matches.begin(), matches.end());
+			for (const auto& [key, i] : matches)
+				if (!InvokeContinue(fn, order.EntityAt(i))) return;
+		}
+
+		void EnsureSparseSlot(IndexType entityIndex) {
+			if constexpr (IsContiguous) {
+				if (indexToSlot.size() <= static_cast<size_t>(entityIndex)) {
+					indexToSlot.resize(static_cast<size_t>(entityIndex) + 1);
+				}
+			} else {
+				indexToSlot.ensure_size(static_cast<size_t>(entityIndex) + 1);
+			}
+		}
+
+	private:
+		DataStorage   data;
+		[[no_unique_address]] EntityStorage slotToEntity;
+		[[no_unique_address]] SparseStorage indexToSlot;
+		[[no_unique_address]] TombstoneStorage tombstones;
+		TypedRegistry* regPtr = nullptr;
+		[[no_unique_address]] ColumnAccessCounter access;
+		[[no_unique_address]] SummaryStorage summaries;
+		[[no_unique_address]] IndexStorage index;
+		[[no_unique_address]] OrderStorage order;
+	};
+
+	// -------------------------------------------------------------------------
+	// Registry
+	// -------------------------------------------------------------------------
+	template<auto CHUNK_SIZE, typename... Cs>
+	class Registry {
+	public:
+		using Self = Registry<CHUNK_SIZE, Cs...>;
+		using TypesList = std::tuple<Cs...>;
+		using StoragesTuple = std::tuple<ComponentStorage<Self, Cs>...>;
+		static constexpr RegistryOptions Options = ToRegistryOptions<CHUNK_SIZE>();
+		static constexpr size_t ChunkSize = Options.chunkSize;
+		static constexpr bool IsContiguous = (ChunkSize == 0);
+		static constexpr bool IsDirect = (Options.layout == ColumnLayout::Direct);
+		static constexpr FreeListPolicy FreeList = Options.freeList;
+		static constexpr bool CopyOnWrite = Options.copyOnWrite;
+		static constexpr size_t MaxEntities = IsContiguous
+			? std::min<size_t>(Options.maxEntities, EntityTraits::INVALID_INDEX) : EntityTraits::INVALID_INDEX;
+		// Contiguous arrays, each reserving room for MaxEntities elements.
+		template <typename U>
+		using ContiguousArray = VirtualArray<U, reserve_bytes_for<U>(MaxEntities)>;
+
+		template <typename, typename>
+		friend class ComponentStorage;
+
+	public:
+		Registry()
+			: storages(ComponentStorage<Self, Cs>(*this)...)
+		{
+			static_assert(NUM_COMPONENTS > 0, "Define at least one component at Registry type level");
+			static_assert(Options.maxEntities > 0, "RegistryOptions::maxEntities must be positive");
+			(ValidateChunk<Cs>(), ...);
+			(ValidateDefaultInitializable<Cs>(), ...);
+		}
+
+		~Registry() { Clear(); }
+		// Copies are explicit, see Clone().
+		Registry(const Registry&) = delete;
+		Registry(Registry&&) noexcept = delete;
+		Registry& operator=(const Registry&) = delete;
+		Registry& operator=(Registry&&) noexcept = delete;
+
+	public:
+		Entity CreateEntity() {
+			const Entity entity = AllocateEntity();
+			const auto i = EntityToIndex(entity);
+
+			for_each_tuple([&entity, i](auto& s) {
+				s.Init(i, entity);
+			}, storages);
+
+			return entity;
+		}
+
+		void DestroyEntity(Entity entity) {
+			CheckEntity(entity);
+
+			const uint32_t index = EntityToIndex(entity);
+
+			for_each_tuple([index](auto& s) {
+				s.Kill(index);
+			}, storages);
+
+			ReleaseEntity(index);
+		}
+
+		// -----------------------------------------------------------------
+		// Bulk spawn / teardown
+		//
+		// CreateEntities fills `out` with new entities; DestroyEntities destroys
+		// every entity in `batch`. Entity ids are handed out and recycled exactly
+		// as by the single-entity calls, in order. The per-column work is then
+		// done one column at a time, and the Parallel* forms give each column
+		// its own thread (threads == 0: hardware_concurrency) - columns share
+		// no memory, so teardown of large non-trivial components scales with
+		// the number of components.
+		//
+		// DestroyEntities throws on the first invalid (or repeated) entity in
+		// `batch`; the entities before it are still destroyed.
+		// -----------------------------------------------------------------
+		void CreateEntities(std::span<Entity> out) { CreateEntitiesImpl(out, 1); }
+		void DestroyEntities(std::span<const Entity> batch) { DestroyEntitiesImpl(batch, 1); }
+
+		void ParallelCreateEntities(std::span<Entity> out, size_t threads = 0) {
+			CreateEntitiesImpl(out, threads);
+		}
 
-			const uint32_t index = EntityToIndex(entity);
+		void ParallelDestroyEntities(std::span<const Entity> batch, size_t threads = 0) {
+			DestroyEntitiesImpl(batch, threads);
+		}
 
-			for_each_tuple([index](auto& s) {
-				s.Kill(index);
-			}, storages);
+		// -----------------------------------------------------------------
+		// Cloning
+		//
+		// Clone returns a deep copy: entity versions, free list and every
+		// dense and sparse array are reproduced exactly, so entities of this
+		// registry are valid in the copy and both evolve identically. Columns
+		// are copied chunk by chunk (a memcpy per chunk for trivially copyable
+		// components); ParallelClone copies the columns on up to `threads`
+		// threads (0: hardware_concurrency). Intended for forking a world, e.g.
+		// for look-ahead simulation or lag compensation.
+		//
+		//   auto fork = reg.Clone();
+		// -----------------------------------------------------------------
+		[[nodiscard]] Registry Clone() const { return Registry(CloneTag{}, *this, 1); }
 
-			// Add to free list - store fNext in freed slot's index bits
-			const uint32_t nextVer = NextEntityVersion(entities[index]);
-			entities[index] = ComposeEntity(fNext, nextVer);
-			fNext = index;
-			++fSize;
+		[[nodiscard]] Registry ParallelClone(size_t threads = 0) const {
+			return Registry(CloneTag{}, *this, threads);
 		}
 
+		// Copy-on-write clone (RegistryOptions::copyOnWrite): the fork shares
+		// every chunk with this registry, and each chunk is copied only when
+		// either registry first writes to it - mutable Get / Set / Each /
+		// EachSpan, create or destroy. Const access never copies. Memory grows
+		// with what the two diverge by.
+		//
+		// Forking itself costs O(chunk count) for the columns, the entity array
+		// and the SummaryKey chunk summaries. The direct layout's alive bitmap
+		// and the LowestIndex free set are copied, at entity count / 64 words
+		// each. Every IndexKey / OrderKey index is deep-copied, which is
+		// O(entity count) per index.
+		//
+		// Both registries may be used from different threads afterwards. Forking
+		// counts as a write to this registry: it invalidates pointers obtained
+		// from it for writing.
+		[[nodiscard]] Registry Fork() requires CopyOnWrite { return Registry(ForkTag{}, *this); }
+
 		[[nodiscard]] bool IsValidEntity(Entity entity) const noexcept {
 			if (IsNullEntity(entity)) return false;
 			const auto i = EntityToIndex(entity);
@@ -468,13 +2415,13 @@ namespace entable {
 		template<typename... Cts>
 		[[nodiscard]] decltype(auto) Get(Entity entity) requires MoreThanOneType<Cts...> && UniqueTypes<Cs...> {
 			const auto idx = EntityToIndex(entity);
-			return std::forward_as_tuple(GetStorage<Cts>().Get(idx)...);
+			return std::tuple<decltype(GetStorage<Cts>().Get(idx))...>(GetStorage<Cts>().Get(idx)...);
 		}
 
 		template<typename... Cts>
 		[[nodiscard]] decltype(auto) Get(Entity entity) const requires MoreThanOneType<Cts...> && UniqueTypes<Cs...> {
 			const auto idx = EntityToIndex(entity);
-			return std::forward_as_tuple(GetStorage<Cts>().Get(idx)...);
+			return std::tuple<decltype(GetStorage<Cts>().Get(idx))...>(GetStorage<Cts>().Get(idx)...);
 		}
 
 		template<typename... Cts>
@@ -508,13 +2455,13 @@ namespace entable {
 		template<typename... Cts>
 		[[nodiscard]] decltype(auto) TryGet(Entity entity) requires MoreThanOneType<Cts...> && UniqueTypes<Cs...> {
 			const auto idx = EntityToIndex(entity);
-			return std::forward_as_tuple(GetStorage<Cts>().TryGet(idx)...);
+			return std::make_tuple(GetStorage<Cts>().TryGet(idx)...);
 		}
 
 		template<typename... Cts>
 		[[nodiscard]] decltype(auto) TryGet(Entity entity) const requires MoreThanOneType<Cts...> && UniqueTypes<Cs...> {
 			const auto idx = EntityToIndex(entity);
-			return std::forward_as_tuple(GetStorage<Cts>().TryGet(idx)...);
+			return std::make_tuple(GetStorage<Cts>().TryGet(idx)...);
 		}
 
 		// -----------------------------------------------------------------
@@ -556,13 +2503,13 @@ namespace entable {
 		template<size_t... Is>
 		[[nodiscard]] decltype(auto) GetByIndices(Entity entity) {
 			const auto idx = EntityToIndex(entity);
-			return std::forward_as_tuple(std::get<Is>(storages).Get(idx)...);
+			return std::tuple<decltype(std::get<Is>(storages).Get(idx))...>(std::get<Is>(storages).Get(idx)...);
 		}
 
 		template<size_t... Is>
 		[[nodiscard]] decltype(auto) GetByIndices(Entity entity) const {
 			const auto idx = EntityToIndex(entity);
-			return std::forward_as_tuple(std::get<Is>(storages).Get(idx)...);
+			return std::tuple<decltype(std::get<Is>(storages).Get(idx))...>(std::get<Is>(storages).Get(idx)...);
 		}
 
 		// -----------------------------------------------------------------
@@ -575,10 +2522,12 @@ namespace entable {
 			requires UniqueTypes<Cs...>
 		{
 			static_assert(sizeof...(Cts) > 0, "Each<> requires at least one component type");
-			const size_t count = GetStorage<FirstComponent<Cts...>>().DenseSize();
-			for (size_t i = 0; i < count; ++i) {
-				std::invoke(fn, GetStorage<Cts>().GetByDenseSlotUnchecked(i)...);
-			}
+			const AccessScope<true, Cts...> scope(GetStorage<Cts>().access...);
+			(GetStorage<Cts>().MarkAllWritten(), ...);
+			const auto& lead = GetStorage<FirstComponent<Cts...>>();
+			lead.ForEachLiveSlot(0, lead.DenseSize(), [&](size_t i) {
+				std::invoke(fn, ColumnAt(GetStorage<Cts>(), lead, i)...);
+			});
 		}
 
 		template<typename... Cts, typename Fn>
@@ -586,33 +2535,440 @@ namespace entable {
 			requires UniqueTypes<Cs...>
 		{
 			static_assert(sizeof...(Cts) > 0, "Each<> requires at least one component type");
-			const size_t count = GetStorage<FirstComponent<Cts...>>().DenseSize();
-			for (size_t i = 0; i < count; ++i) {
-				std::invoke(fn, GetStorage<Cts>().GetByDenseSlotUnchecked(i)...);
+			const AccessScope<false, Cts...> scope(GetStorage<Cts>().access...);
+			const auto& lead = GetStorage<FirstComponent<Cts...>>();
+			lead.ForEachLiveSlot(0, lead.DenseSize(), [&](size_t i) {
+				std::invoke(fn, ColumnAt(GetStorage<Cts>(), lead, i)...);
+			});
+		}
+
+		// -----------------------------------------------------------------
+		// Packed-column queries (UserConfig<C>::PackedBits)
+		//
+		// CountEqual counts the entities whose C equals value with one popcount
+		// per 64 / PackedBits entities. EachEqual visits them like Each<C, Cts...>,
+		// finding each match with countr_zero instead of testing every entity.
+		// -----------------------------------------------------------------
+		template<typename C>
+		[[nodiscard]] size_t CountEqual(C value) const
+			requires UniqueTypes<Cs...>
+		{
+			const auto& s = GetStorage<C>();
+			static_assert(std::decay_t<decltype(s)>::IsPacked, "CountEqual<> requires UserConfig<C>::PackedBits");
+			const AccessGuard<false> guard(s.access);
+			return s.CountEqual(value);
+		}
+
+		template<typename C, typename... Cts, typename Fn>
+		void EachEqual(C value, Fn&& fn)
+			requires UniqueTypes<Cs...>
+		{
+			const AccessScope<true, C, Cts...> scope(GetStorage<C>().access, GetStorage<Cts>().access...);
+			(GetStorage<Cts>().MarkAllWritten(), ...);
+			EachEqualImpl<C, Cts...>(*this, value, fn);
+		}
+
+		template<typename C, typename... Cts, typename Fn>
+		void EachEqual(C value, Fn&& fn) const
+			requires UniqueTypes<Cs...>
+		{
+			const AccessScope<false, C, Cts...> scope(GetStorage<C>().access, GetStorage<Cts>().access...);
+			EachEqualImpl<C, Cts...>(*this, value, fn);
+		}
+
+		// -----------------------------------------------------------------
+		// Zipped span iteration
+		//
+		// Calls fn(std::span<Cts>...) with equally long runs of the same slots
+		// of every column. Columns may use different chunk sizes (ChunkBytes):
+		// runs end at every chunk boundary of the column with the smallest
+		// chunks, so each span is contiguous. Columns with holes (direct layout,
+		// StableAddresses) yield their default-valued holes too, as
+		// Components() does. The columns must share a slot layout and not
+		// split fields.
+		// -----------------------------------------------------------------
+		template<typename... Cts, typename Fn>
+		void EachSpan(Fn&& fn)
+			requires UniqueTypes<Cs...>
+		{
+			static_assert(sizeof...(Cts) > 0, "EachSpan<> requires at least one component type");
+			ValidateSpanColumns<Cts...>();
+			const AccessScope<true, Cts...> scope(GetStorage<Cts>().access...);
+			(GetStorage<Cts>().MarkAllWritten(), ...);
+			ForEachZippedRun<Cts...>([&](size_t lo, size_t n) {
+				std::invoke(fn, std::span<Cts>(&GetStorage<Cts>().GetByDenseSlotUnchecked(lo), n)...);
+			});
+		}
+
+		template<typename... Cts, typename Fn>
+		void EachSpan(Fn&& fn) const
+			requires UniqueTypes<Cs...>
+		{
+			static_assert(sizeof...(Cts) > 0, "EachSpan<> requires at least one component type");
+			ValidateSpanColumns<Cts...>();
+			const AccessScope<false, Cts...> scope(GetStorage<Cts>().access...);
+			ForEachZippedRun<Cts...>([&](size_t lo, size_t n) {
+				std::invoke(fn, std::span<const Cts>(&GetStorage<Cts>().GetByDenseSlotUnchecked(lo), n)...);
+			});
+		}
+
+		// -----------------------------------------------------------------
+		// Filtered iteration with chunk pruning
+		//
+		// The first component must declare UserConfig<C>::SummaryKey. For every
+		// chunk of the dense columns, chunkPredicate(const KeyRange<Key>&) is
+		// asked whether the chunk can contain a match; chunks it rejects are
+		// skipped entirely, all others are visited with fn exactly like Each.
+		// fn still sees every entity of a visited chunk and must apply its own
+		// per-entity filter.
+		//
+		//   reg.EachWhere<Health, Pos>(
+		//       [](const auto& r) { return r.min <= 0; },
+		//       [](Health& h, Pos& p) { if (h.value <= 0) ... });
+		//
+		// The mutable overload refreshes dirty summaries first and marks every
+		// visited chunk dirty again (fn may have written to it). The const
+		// overload never writes: chunks whose summary is stale are visited
+		// unconditionally. Call RefreshSummaries<C>() to bring them up to date.
+		// Writes through pointers retained across calls are not tracked.
+		// -----------------------------------------------------------------
+		template<typename... Cts, typename Pred, typename Fn>
+		void EachWhere(Pred&& chunkPredicate, Fn&& fn)
+			requires UniqueTypes<Cs...>
+		{
+			static_assert(sizeof...(Cts) > 0, "EachWhere<> requires at least one component type");
+			using Lead = FirstComponent<Cts...>;
+			static_assert(HasSummaryKey<Lead>, "EachWhere<> requires UserConfig<First>::SummaryKey");
+			const AccessScope<true, Cts...> scope(GetStorage<Cts>().access...);
+
+			auto& lead = GetStorage<Lead>();
+			constexpr size_t Granule = std::decay_t<decltype(lead)>::SpanSize;
+			const size_t count = lead.DenseSize();
+			(GetStorage<Cts>().MarkKeysDirty(), ...);
+			(MarkForeignSummariesDirty(GetStorage<Cts>(), lead), ...);
+			lead.summaries.Refresh(lead.data, count);
+			for (size_t g = 0, lo = 0; lo < count; ++g, lo += Granule) {
+				if (!std::invoke(chunkPredicate, lead.summaries.Range(g)))
+					continue;
+				const size_t hi = std::min(lo + Granule, count);
+				lead.ForEachLiveSlot(lo, hi, [&](size_t i) {
+					std::invoke(fn, ColumnAt(GetStorage<Cts>(), lead, i)...);
+				});
+				(MarkSummariesWritten(GetStorage<Cts>(), lead, lo, hi), ...);
+			}
+		}
+
+		template<typename... Cts, typename Pred, typename Fn>
+		void EachWhere(Pred&& chunkPredicate, Fn&& fn) const
+			requires UniqueTypes<Cs...>
+		{
+			static_assert(sizeof...(Cts) > 0, "EachWhere<> requires at least one component type");
+			using Lead = FirstComponent<Cts...>;
+			static_assert(HasSummaryKey<Lead>, "EachWhere<> requires UserConfig<First>::SummaryKey");
+			const AccessScope<false, Cts...> scope(GetStorage<Cts>().access...);
+
+			const auto& lead = GetStorage<Lead>();
+			constexpr size_t Granule = std::decay_t<decltype(lead)>::SpanSize;
+			const size_t count = lead.DenseSize();
+			for (size_t g = 0, lo = 0; lo < count; ++g, lo += Granule) {
+				if (lead.summaries.IsClean(g) && !std::invoke(chunkPredicate, lead.summaries.Range(g)))
+					continue;
+				const size_t hi = std::min(lo + Granule, count);
+				lead.ForEachLiveSlot(lo, hi, [&](size_t i) {
+					std::invoke(fn, ColumnAt(GetStorage<Cts>(), lead, i)...);
+				});
 			}
 		}
 
+		// Recomputes stale chunk summaries of C so that subsequent const
+		// EachWhere calls can prune again.
+		template<typename C>
+		void RefreshSummaries()
+			requires UniqueTypes<Cs...>
+		{
+			static_assert(HasSummaryKey<C>, "RefreshSummaries<> requires UserConfig<C>::SummaryKey");
+			auto& s = GetStorage<C>();
+			const AccessGuard<true> guard(s.access);
+			s.summaries.Refresh(s.data, s.DenseSize());
+		}
+
+		// -----------------------------------------------------------------
+		// Secondary index lookups (UserConfig<C>::IndexKey)
+		//
+		// FindBy returns the entity whose C has the given key, or NullEntity;
+		// with several (no UniqueIndex) it returns the one keyed most recently.
+		// FindAllBy calls fn(Entity) for each of them, CountBy counts them.
+		// The default key of C{} is never indexed: looking it up finds nothing.
+		//
+		//   const Entity player = reg.FindBy<PlayerId>(4711u);
+		//
+		// Set, CreateEntity and DestroyEntity keep the index current. Writes
+		// through mutable Get / TryGet only flag that entity, and mutable Each
+		// / EachSpan / Components flag the whole column; the next mutable
+		// lookup re-keys what was flagged (O(flagged), O(N) after a sweep).
+		// Const lookups never write: while the index is stale they scan the
+		// column instead. Call RefreshIndex<C>() to bring it up to date.
+		// fn may return false to stop early; it must not change or destroy
+		// the entities it is given.
+		// -----------------------------------------------------------------
+		template<typename C>
+		[[nodiscard]] Entity FindBy(const IndexKeyType<C>& key)
+			requires UniqueTypes<Cs...> && HasIndexKey<C>
+		{
+			Entity found = NullEntity;
+			FindAllBy<C>(key, [&found](Entity e) { found = e; return false; });
+			return found;
+		}
+
+		template<typename C>
+		[[nodiscard]] Entity FindBy(const IndexKeyType<C>& key) const
+			requires UniqueTypes<Cs...> && HasIndexKey<C>
+		{
+			Entity found = NullEntity;
+			FindAllBy<C>(key, [&found](Entity e) { found = e; return false; });
+			return found;
+		}
+
+		template<typename C, typename Fn>
+		void FindAllBy(const IndexKeyType<C>& key, Fn&& fn)
+			requires UniqueTypes<Cs...> && HasIndexKey<C>
+		{
+			auto& s = GetStorage<C>();
+			const AccessGuard<true> guard(s.access);
+			s.RefreshKeys(s.index);
+			s.ForEachWithKey(key, fn);
+		}
+
+		template<typename C, typename Fn>
+		void FindAllBy(const IndexKeyType<C>& key, Fn&& fn) const
+			requires UniqueTypes<Cs...> && HasIndexKey<C>
+		{
+			const auto& s = GetStorage<C>();
+			const AccessGuard<false> guard(s.access);
+			s.ForEachWithKey(key, fn);
+		}
+
+		template<typename C>
+		[[nodiscard]] size_t CountBy(const IndexKeyType<C>& key)
+			requires UniqueTypes<Cs...> && HasIndexKey<C>
+		{
+			size_t n = 0;
+			FindAllBy<C>(key, [&n](Entity) { ++n; });
+			return n;
+		}
+
+		template<typename C>
+		[[nodiscard]] size_t CountBy(const IndexKeyType<C>& key) const
+			requires UniqueTypes<Cs...> && HasIndexKey<C>
+		{
+			size_t n = 0;
+			FindAllBy<C>(key, [&n](Entity) { ++n; });
+			return n;
+		}
+
+		// -----------------------------------------------------------------
+		// Ordered index scans (UserConfig<C>::OrderKey)
+		//
+		// RangeEach calls fn(Entity) for every entity with lo <= key < hi in
+		// ascending key order (equal keys by entity index), RangeEachReverse
+		// in descending order. OrderedEach / OrderedEachReverse visit every
+		// indexed entity. The cost is O(log N) plus the entities visited, and
+		// fn may return false to stop early; it must not change or destroy
+		// the entities it is given - collect them first. The default key of
+		// C{} is never indexed, and the index is kept current exactly like
+		// the IndexKey one; while stale, const scans sort the matches of a
+		// column scan instead.
+		//
+		//   std::vector<Entity> expired;
+		//   reg.RangeEach<ExpireTime>(0u, now, [&](Entity e) { expired.push_back(e); });
+		//   reg.DestroyEntities(expired);
+		//
+		//   int n = 10;  // top 10 by score
+		//   reg.OrderedEachReverse<Score>([&](Entity e) { ...; return --n > 0; });
+		// -----------------------------------------------------------------
+		template<typename C, typename Fn>
+		void RangeEach(const OrderKeyType<C>& lo, const OrderKeyType<C>& hi, Fn&& fn)
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, false>(*this, &lo, &hi, fn);
+		}
+
+		template<typename C, typename Fn>
+		void RangeEach(const OrderKeyType<C>& lo, const OrderKeyType<C>& hi, Fn&& fn) const
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, false>(*this, &lo, &hi, fn);
+		}
+
+		template<typename C, typename Fn>
+		void RangeEachReverse(const OrderKeyType<C>& lo, const OrderKeyType<C>& hi, Fn&& fn)
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, true>(*this, &lo, &hi, fn);
+		}
+
+		template<typename C, typename Fn>
+		void RangeEachReverse(const OrderKeyType<C>& lo, const OrderKeyType<C>& hi, Fn&& fn) const
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, true>(*this, &lo, &hi, fn);
+		}
+
+		template<typename C, typename Fn>
+		void OrderedEach(Fn&& fn)
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, false>(*this, nullptr, nullptr, fn);
+		}
+
+		template<typename C, typename Fn>
+		void OrderedEach(Fn&& fn) const
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, false>(*this, nullptr, nullptr, fn);
+		}
+
+		template<typename C, typename Fn>
+		void OrderedEachReverse(Fn&& fn)
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, true>(*this, nullptr, nullptr, fn);
+		}
+
+		template<typename C, typename Fn>
+		void OrderedEachReverse(Fn&& fn) const
+			requires UniqueTypes<Cs...> && HasOrderKey<C>
+		{
+			OrderedEachImpl<C, true>(*this, nullptr, nullptr, fn);
+		}
+
+		// Re-keys the entities written through references since the last
+		// lookup, so that subsequent const lookups use C's indices again.
+		template<typename C>
+		void RefreshIndex()
+			requires UniqueTypes<Cs...> && (HasIndexKey<C> || HasOrderKey<C>)
+		{
+			auto& s = GetStorage<C>();
+			const AccessGuard<true> guard(s.access);
+			s.RefreshKeys(s.index);
+			s.RefreshKeys(s.order);
+		}
+
+		// -----------------------------------------------------------------
+		// Column reductions
+		//
+		// Run span-at-a-time over the dense column of C (no per-entity
+		// indirection) with transform_reduce_span's multi-accumulator inner loop.
+		// `reduce` must be associative and commutative: partial results are
+		// combined in an unspecified order.
+		// -----------------------------------------------------------------
+		template<typename C, typename T, typename ReduceOp, typename Transform>
+		[[nodiscard]] T TransformReduce(T init, ReduceOp reduce, Transform transform) const
+			requires UniqueTypes<Cs...>
+		{
+			const auto& s = GetStorage<C>();
+			const AccessGuard<false> guard(s.access);
+			size_t base = 0;
+			s.ForEachSpan([&](std::span<const C> span) {
+				if (auto partial = ReduceLiveSpan<T>(s, span, base, reduce, transform))
+					init = std::invoke(reduce, init, std::move(*partial));
+				base += span.size();
+			});
+			return init;
+		}
+
+		template<typename C, typename Proj, typename ReduceOp,
+			typename R = std::remove_cvref_t<std::invoke_result_t<Proj&, const C&>>>
+		[[nodiscard]] R Reduce(Proj projection, ReduceOp reduce, R init = R{}) const
+			requires UniqueTypes<Cs...>
+		{
+			return TransformReduce<C>(init, reduce, projection);
+		}
+
+		template<typename C, typename Proj>
+		[[nodiscard]] auto Sum(Proj projection) const
+			requires UniqueTypes<Cs...>
+		{
+			return Reduce<C>(projection, std::plus<>{});
+		}
+
+		template<typename C, typename Proj,
+			typename R = std::remove_cvref_t<std::invoke_result_t<Proj&, const C&>>>
+		[[nodiscard]] R Min(Proj projection) const
+			requires UniqueTypes<Cs...> && std::is_arithmetic_v<R>
+		{
+			return Reduce<C>(projection, [](R a, R b) { return b < a ? b : a; }, std::numeric_limits<R>::max());
+		}
+
+		template<typename C, typename Proj,
+			typename R = std::remove_cvref_t<std::invoke_result_t<Proj&, const C&>>>
+		[[nodiscard]] R Max(Proj projection) const
+			requires UniqueTypes<Cs...> && std::is_arithmetic_v<R>
+		{
+			return Reduce<C>(projection, [](R a, R b) { return a < b ? b : a; }, std::numeric_limits<R>::lowest());
+		}
+
+		template<typename C, typename Pred>
+		[[nodiscard]] size_t Count(Pred predicate) const
+			requires UniqueTypes<Cs...>
+		{
+			return TransformReduce<C>(size_t{ 0 }, std::plus<>{},
+				[&predicate](const C& c) -> size_t { return std::invoke(predicate, c) ? 1 : 0; });
+		}
+
+		// Parallel TransformReduce: spans are split across `threads` workers
+		// (0 = hardware concurrency), each producing a private partial that is
+		// folded into init on the calling thread.
+		template<typename C, typename T, typename ReduceOp, typename Transform>
+		[[nodiscard]] T ParallelTransformReduce(T init, ReduceOp reduce, Transform transform, size_t threads = 0) const
+			requires UniqueTypes<Cs...>
+		{
+			const auto& s = GetStorage<C>();
+			const AccessGuard<false> guard(s.access);
+			constexpr size_t SpanSize = std::decay_t<decltype(s)>::SpanSize;
+			const auto spans = s.GetDataSpans();
+			if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+			std::vector<std::optional<T>> partials(std::min(threads, spans.size()));
+			parallel_for(spans.size(), threads, [&](size_t worker, size_t begin, size_t end) {
+				ReduceOp localReduce = reduce;
+				Transform localTransform = transform;
+				std::optional<T> acc;
+				for (size_t i = begin; i < end; ++i) {
+					auto partial = ReduceLiveSpan<T>(s, spans[i], i * SpanSize, localReduce, localTransform);
+					if (!partial) continue;
+					acc = acc ? std::invoke(localReduce, std::move(*acc), std::move(*partial)) : std::move(partial);
+				}
+				partials[worker] = std::move(acc);
+			});
+			for (auto& p : partials)
+				if (p) init = std::invoke(reduce, init, *p);
+			return init;
+		}
+
 		// -----------------------------------------------------------------
 		// Iteration - index-based API (always available)
 		// -----------------------------------------------------------------
 		template<size_t... Is, typename Fn>
 		void EachByIndex(Fn&& fn) {
 			static_assert(sizeof...(Is) > 0, "EachByIndex<> requires at least one index");
+			const AccessScope<true, std::tuple_element_t<Is, TypesList>...> scope(std::get<Is>(storages).access...);
+			(std::get<Is>(storages).MarkAllWritten(), ...);
 			// Use first storage's size (dense) instead of entities size (now sparse)
-			const size_t count = std::get<FirstIndex<Is...>()>(storages).DenseSize();
-			for (size_t i = 0; i < count; ++i) {
-				fn(std::get<Is>(storages).GetByDenseSlotUnchecked(i)...);
-			}
+			const auto& lead = std::get<FirstIndex<Is...>()>(storages);
+			lead.ForEachLiveSlot(0, lead.DenseSize(), [&](size_t i) {
+				fn(ColumnAt(std::get<Is>(storages), lead, i)...);
+			});
 		}
 
 		template<size_t... Is, typename Fn>
 		void EachByIndex(Fn&& fn) const {
 			static_assert(sizeof...(Is) > 0, "EachByIndex<> requires at least one index");
+			const AccessScope<false, std::tuple_element_t<Is, TypesList>...> scope(std::get<Is>(storages).access...);
 			// Use first storage's size (dense) instead of entities size (now sparse)
-			const size_t count = std::get<FirstIndex<Is...>()>(storages).DenseSize();
-			for (size_t i = 0; i < count; ++i) {
-				fn(std::get<Is>(storages).GetByDenseSlotUnchecked(i)...);
-			}
+			const auto& lead = std::get<FirstIndex<Is...>()>(storages);
+			lead.ForEachLiveSlot(0, lead.DenseSize(), [&](size_t i) {
+				fn(ColumnAt(std::get<Is>(storages), lead, i)...);
+			});
 		}
 
 		// -----------------------------------------------------------------
@@ -647,22 +3003,128 @@ namespace entable {
 			return std::get<I>(storages).GetDataSpans();
 		}
 
+		// -----------------------------------------------------------------
+		// Field span access - SplitFields components
+		// Returns vector of spans over member I of C, one per chunk
+		// -----------------------------------------------------------------
+		template<typename C, size_t I>
+		[[nodiscard]] auto FieldComponents()
+			requires UniqueTypes<Cs...>
+		{
+			auto& s = GetStorage<C>();
+			using F = std::remove_reference_t<decltype(s.data.template Field<I>()[0])>;
+			std::vector<std::span<F>> result;
+			s.template ForEachFieldSpan<I>([&result](std::span<F> span) { result.push_back(span); });
+			return result;
+		}
+
+		template<typename C, size_t I>
+		[[nodiscard]] auto FieldComponents() const
+			requires UniqueTypes<Cs...>
+		{
+			const auto& s = GetStorage<C>();
+			using F = std::remove_reference_t<decltype(s.data.template Field<I>()[0])>;
+			std::vector<std::span<F>> result;
+			s.template ForEachFieldSpan<I>([&result](std::span<F> span) { result.push_back(span); });
+			return result;
+		}
+
+		// -----------------------------------------------------------------
+		// Access scopes
+		//
+		// Get / TryGet / Components hand out references and spans whose lifetime
+		// the registry cannot observe. Hold a scope for as long as those are in
+		// use so that checked builds (ENTABLE_ACCESS_CHECKS=1) can detect a
+		// conflicting Set / Each / CreateEntity from another thread. Each,
+		// EachByIndex, Set and the structural operations acquire their scopes
+		// internally: non-const Each counts as a write, const Each as a read.
+		// In release builds the returned tuple is empty and costs nothing.
+		//
+		//   const auto scope = reg.ReadScope<Position, Velocity>();
+		// -----------------------------------------------------------------
+		template<typename... Cts>
+		[[nodiscard]] AccessScope<false, Cts...> ReadScope() const
+			requires UniqueTypes<Cs...>
+		{
+			return AccessScope<false, Cts...>(GetStorage<Cts>().access...);
+		}
+
+		template<typename... Cts>
+		[[nodiscard]] AccessScope<true, Cts...> WriteScope() const
+			requires UniqueTypes<Cs...>
+		{
+			return AccessScope<true, Cts...>(GetStorage<Cts>().access...);
+		}
+
+		// Direct layout: bit i of word i / 64 is set while the entity with index i
+		// is live. Components() spans cover holes too; use this to skip them.
+		[[nodiscard]] std::span<const uint64_t> AliveMask() const noexcept
+			requires IsDirect
+		{
+			return alive;
+		}
+
 		// -----------------------------------------------------------------
 		// Housekeeping
 		// -----------------------------------------------------------------
 		void Clear() noexcept {
 			for_each_tuple([](auto& s) { s.Clear(); }, storages);
-			entities.clear();
-			fNext = EntityTraits::INVALID_INDEX;
-			fSize = 0;
+			ResetEntities();
 		}
 
-		// Shrinks all dense component storages to fit their current size.
-		// This only applies to component data storages, not the EntitiesStorage.
-		// For contiguous storage (CHUNK_SIZE=0), uses std::vector::shrink_to_fit().
+		// Compacts the registry: free indices at the end of `entities` are
+		// dropped (and unlinked from the free list), every column's sparse and
+		// reverse arrays are cut to the remaining index range, and all arrays
+		// release spare capacity. Live entities and their handles are untouched.
+		// For contiguous storage (CHUNK_SIZE=0), uses VirtualArray::shrink_to_fit(),
+		// which decommits the pages past the last element.
 		// For chunked storage (CHUNK_SIZE>0), uses ChunkedArray::shrink_to_fit().
 		void ShrinkToFit() noexcept {
-			for_each_tuple([](auto& s) { s.ShrinkToFit(); }, storages);
+			const size_t indexCount = TrimFreeTail();
+			for_each_tuple([indexCount](auto& s) { s.ShrinkToFit(indexCount); }, storages);
+		}
+
+		// Bytes held by the registry's entity array, bitmaps and all columns,
+		// and the part of them the current contents need. Call before and after
+		// ShrinkToFit to see what it reclaimed. Walks the entity array from the
+		// back to find the last live index; otherwise O(number of arrays).
+		[[nodiscard]] Footprint MemoryFootprint() const noexcept {
+			const size_t indexCount = LiveIndexCount();
+			Footprint f = ColumnFootprint(entities, indexCount);
+			if constexpr (IsDirect) f += ColumnFootprint(alive, (indexCount + 63) / 64);
+			if constexpr (FreeList == FreeListPolicy::LowestIndex) f += freeIndices.MemoryFootprint(indexCount);
+			for_each_tuple([&f, indexCount](const auto& s) { f += s.MemoryFootprint(indexCount); }, storages);
+			return f;
+		}
+
+		// Per-column allocation, live bytes and chunk occupancy, without the
+		// scans MemoryFootprint does: O(number of arrays), cheap enough to poll
+		// every frame. Allocated bytes match MemoryFootprint(); used bytes count
+		// only live entities, so holes and free-list entries show as reclaimable.
+		[[nodiscard]] RegistryMemoryStats<sizeof...(Cs)> MemoryStats() const noexcept {
+			RegistryMemoryStats<sizeof...(Cs)> stats;
+			stats.liveEntities = Size();
+			stats.freeListLength = fSize;
+			stats.entities = ColumnFootprint(entities, stats.liveEntities);
+			if constexpr (IsDirect) stats.entities += ColumnFootprint(alive, alive.size());
+			if constexpr (FreeList == FreeListPolicy::LowestIndex) stats.entities += freeIndices.MemoryFootprint(entities.size());
+			[&]<size_t... Is>(std::index_sequence<Is...>) {
+				((stats.columns[Is] = std::get<Is>(storages).MemoryStats(stats.liveEntities)), ...);
+			}(std::index_sequence_for<Cs...>{});
+			return stats;
+		}
+
+		// Clear / ShrinkToFit with each column handled on its own thread
+		// (threads == 0: hardware_concurrency). Worth it when components own
+		// heap memory whose destructors or reallocation dominate.
+		void ParallelClear(size_t threads = 0) {
+			parallel_for_each_tuple([](auto& s) { s.Clear(); }, storages, threads);
+			ResetEntities();
+		}
+
+		void ParallelShrinkToFit(size_t threads = 0) {
+			const size_t indexCount = TrimFreeTail();
+			parallel_for_each_tuple([indexCount](auto& s) { s.ShrinkToFit(indexCount); }, storages, threads);
 		}
 
 		// Returns the number of live entities (total slots minus free slots)
@@ -682,13 +3144,13 @@ namespace entable {
 		template<typename T>
 		inline decltype(auto) ForwardNonEmpty(Entity e) {
 			if constexpr (std::is_empty_v<T>) return std::tuple<>{};
-			else return std::forward_as_tuple(GetStorage<T>().Get(EntityToIndex(e)));
+			else return std::tuple<decltype(GetStorage<T>().Get(EntityToIndex(e)))>(GetStorage<T>().Get(EntityToIndex(e)));
 		}
 
 		template<typename T>
 		inline decltype(auto) ForwardNonEmpty(Entity e) const {
 			if constexpr (std::is_empty_v<T>) return std::tuple<>{};
-			else return std::forward_as_tuple(GetStorage<T>().Get(EntityToIndex(e)));
+			else return std::tuple<decltype(GetStorage<T>().Get(EntityToIndex(e)))>(GetStorage<T>().Get(EntityToIndex(e)));
 		}
 
 		void CheckEntity(Entity entity) const {
@@ -701,11 +3163,329 @@ namespace entable {
 				throw std::runtime_error("Invalid Entity (not active or stale version)");
 		}
 
+		template <typename C, typename... Cts, typename Reg, typename Fn>
+		static void EachEqualImpl(Reg& reg, C value, Fn& fn) {
+			auto& lead = reg.template GetStorage<C>();
+			using Lead = std::decay_t<decltype(lead)>;
+			static_assert(Lead::IsPacked, "EachEqual<> requires UserConfig<C>::PackedBits");
+			lead.data.ForEachEqual(value, 0, lead.DenseSize(), [&](size_t slot) {
+				if constexpr (Lead::HasHoles) {
+					if ((lead.LiveMask()[slot / 64] >> (slot % 64) & 1) == 0) return;
+				}
+				std::invoke(fn, lead.GetByDenseSlotUnchecked(slot), ColumnAt(reg.template GetStorage<Cts>(), lead, slot)...);
+			});
+		}
+
+		template <typename C, bool REVERSE, typename Reg, typename Fn>
+		static void OrderedEachImpl(Reg& reg, const OrderKeyType<C>* lo, const OrderKeyType<C>* hi, Fn& fn) {
+			auto& s = reg.template GetStorage<C>();
+			const AccessGuard<!std::is_const_v<Reg>> guard(s.access);
+			if constexpr (!std::is_const_v<Reg>)
+				s.RefreshKeys(s.order);
+			s.template ForEachInRange<REVERSE>(lo, hi, fn);
+		}
+
+		template <typename... Cts>
+		static constexpr void ValidateSpanColumns() {
+			using Lead = ComponentStorage<Self, FirstComponent<Cts...>>;
+			static_assert(((ComponentStorage<Self, Cts>::SlotSpace == Lead::SlotSpace) && ...),
+				"EachSpan<> columns must share a slot layout (do not mix StableAddresses with packed columns)");
+			static_assert(!(ComponentStorage<Self, Cts>::IsProxied || ...),
+				"EachSpan<> is unavailable for SplitFields / PackedBits components");
+		}
+
+		// Calls fn(lo, n) for consecutive runs [lo, lo + n) of the dense slots
+		// that stay within one chunk of every column in Cts.
+		template <typename... Cts, typename Fn>
+		void ForEachZippedRun(Fn&& fn) const {
+			constexpr size_t Run = std::min({ ComponentStorage<Self, Cts>::SpanSize... });
+			const size_t count = GetStorage<FirstComponent<Cts...>>().DenseSize();
+			for (size_t lo = 0; lo < count; lo += Run)
+				fn(lo, std::min(Run, count - lo));
+		}
+
+		// Component of `column` belonging to the entity at `slot` of `lead`:
+		// read at the same slot when both columns share a slot layout, looked up
+		// through the entity index otherwise (StableAddresses mixed with packed).
+		template <typename Column, typename Lead>
+		FORCE_INLINE static decltype(auto) ColumnAt(Column& column, const Lead& lead, size_t slot) {
+			if constexpr (std::decay_t<Column>::SlotSpace == Lead::SlotSpace)
+				return column.GetByDenseSlotUnchecked(slot);
+			else
+				return column.Get(lead.IndexAtSlot(slot));
+		}
+
+		// Flags the summaries of `column` written for lead slots [lo, hi): every
+		// granule overlapping them, which may be several when the column has
+		// smaller chunks than the lead. Columns in another slot space reach
+		// scattered slots instead; MarkForeignSummariesDirty flags them whole.
+		template <typename Column, typename Lead>
+		FORCE_INLINE static void MarkSummariesWritten(Column& column, const Lead&, size_t lo, size_t hi) noexcept {
+			if constexpr (Column::SlotSpace == Lead::SlotSpace)
+				column.summaries.MarkDirty(lo, hi);
+		}
+
+		template <typename Column, typename Lead>
+		static void MarkForeignSummariesDirty(Column& column, const Lead&) noexcept {
+			if constexpr (Column::SlotSpace != Lead::SlotSpace)
+				column.summaries.MarkAllDirty();
+		}
+
+		// Reduces the live elements of a column span starting at slot `base`
+		// (a multiple of 64); nullopt when none is live. Fully live runs still
+		// go through transform_reduce_span.
+		template <typename T, typename Storage, typename U, typename ReduceOp, typename Transform>
+		[[nodiscard]] static std::optional<T> ReduceLiveSpan(const Storage& s, std::span<const U> span, size_t base, ReduceOp& reduce, Transform& transform) {
+			if constexpr (!Storage::HasHoles) {
+				return transform_reduce_span<8, T>(span, reduce, transform);
+			} else {
+				assert(base % 64 == 0);
+				const std::span<const uint64_t> alive = s.LiveMask();
+				std::optional<T> acc;
+				const auto fold = [&](T value) {
+					acc = acc ? std::invoke(reduce, std::move(*acc), std::move(value)) : std::move(value);
+				};
+				const auto liveBits = [&](size_t offset) {
+					const size_t n = std::min<size_t>(64, span.size() - offset);
+					const uint64_t lanes = n == 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << n) - 1;
+					return std::pair{ alive[(base + offset) / 64] & lanes, lanes };
+				};
+				for (size_t offset = 0; offset < span.size();) {
+					auto [bits, lanes] = liveBits(offset);
+					if (bits == lanes) {
+						size_t run = offset + std::popcount(lanes);
+						while (run < span.size()) {
+							const auto [b, l] = liveBits(run);
+							if (b != l) break;
+							run += std::popcount(l);
+						}
+						fold(transform_reduce_span<8, T>(span.subspan(offset, run - offset), reduce, transform));
+						offset = run;
+						continue;
+					}
+					for (; bits != 0; bits &= bits - 1)
+						fold(std::invoke(transform, span[offset + std::countr_zero(bits)]));
+					offset += std::popcount(lanes);
+				}
+				return acc;
+			}
+		}
+
+		// Hands out an entity id (free list first) without touching the columns.
+		Entity AllocateEntity() {
+			if (fSize > 0) {
+				// Reuse from free list
+				const auto i = PopFreeIndex();
+				const auto v = EntityToVersion(entities[i]);
+				entities[i] = ComposeEntity(i, v);   // Mark as live
+				if constexpr (IsDirect) alive[i / 64] |= uint64_t{ 1 } << (i % 64);
+				return entities[i];
+			}
+
+			// Allocate fresh slot
+			if (entities.size() >= MaxEntities) {
+				throw std::runtime_error("Can't create Entity (too many entities)");
+			}
+			const auto i = static_cast<uint32_t>(entities.size());
+			if constexpr (IsDirect) {
+				if (alive.size() <= i / 64) alive.push_back(0);
+			}
+			if constexpr (FreeList == FreeListPolicy::LowestIndex) {
+				// Sized up front so that ReleaseEntity never allocates.
+				freeIndices.Reserve(i);
+			}
+			// Indices dropped by TrimFreeTail come back past every version they
+			// had, so handles from before the trim stay invalid.
+			const uint32_t version = i < regrowLimit ? regrowVersion : 0u;
+			const Entity entity = entities.emplace_back(ComposeEntity(i, version));
+			if constexpr (IsDirect) alive[i / 64] |= uint64_t{ 1 } << (i % 64);
+			return entity;
+		}
+
+		void ReleaseEntity(uint32_t index) noexcept {
+			PushFreeIndex(index, NextEntityVersion(entities[index]));
+			if constexpr (IsDirect) alive[index / 64] &= ~(uint64_t{ 1 } << (index % 64));
+		}
+
+		// Free list. A freed slot of `entities` keeps its next version in the
+		// version bits; the index bits hold the next free index for the
+		// intrusive Lifo/Fifo chains (fNext = head, fTail = Fifo tail) and
+		// INVALID_INDEX for LowestIndex, which tracks free indices in
+		// freeIndices and keeps fNext at the lowest one.
+		void PushFreeIndex(uint32_t index, uint32_t version) noexcept {
+			if constexpr (FreeList == FreeListPolicy::Lifo) {
+				entities[index] = ComposeEntity(fNext, version);
+				fNext = index;
+			} else if constexpr (FreeList == FreeListPolicy::Fifo) {
+				entities[index] = ComposeEntity(EntityTraits::INVALID_INDEX, version);
+				if (fSize == 0)
+					fNext = index;
+				else
+					entities[fTail] = ComposeEntity(index, EntityToVersion(entities[fTail]));
+				fTail = index;
+			} else {
+				entities[index] = ComposeEntity(EntityTraits::INVALID_INDEX, version);
+				freeIndices.Insert(index);
+				fNext = std::min(fNext, index);
+			}
+			++fSize;
+		}
+
+		uint32_t PopFreeIndex() noexcept {
+			assert(fSize > 0);
+			const uint32_t i = fNext;
+			--fSize;
+			if constexpr (FreeList == FreeListPolicy::LowestIndex) {
+				freeIndices.Erase(i);
+				fNext = freeIndices.FindFrom(i);
+			} else {
+				fNext = EntityToIndex(entities[i]);  // Get next from current head
+			}
+			return i;
+		}
+
+		// Index one past the last live entity.
+		[[nodiscard]] size_t LiveIndexCount() const noexcept {
+			size_t n = entities.size();
+			while (n > 0 && EntityToIndex(entities[n - 1]) != n - 1)
+				--n;
+			return n;
+		}
+
+		// Drops the free indices at the end of `entities`; returns the new size.
+		size_t TrimFreeTail() noexcept {
+			const size_t n = LiveIndexCount();
+			if (n < entities.size()) {
+				for (size_t i = n; i < entities.size(); ++i)
+					regrowVersion = std::max(regrowVersion, EntityToVersion(entities[i]));
+				regrowLimit = std::max(regrowLimit, static_cast<uint32_t>(entities.size()));
+
+				if constexpr (FreeList == FreeListPolicy::LowestIndex) {
+					freeIndices.Truncate(n);
+					if (fNext >= n) fNext = EntityTraits::INVALID_INDEX;
+				} else {
+					// Relink the chain without the dropped indices, keeping its order.
+					uint32_t head = EntityTraits::INVALID_INDEX;
+					uint32_t prev = EntityTraits::INVALID_INDEX;
+					for (uint32_t i = fNext, k = 0; k < fSize; ++k) {
+						const uint32_t next = EntityToIndex(entities[i]);
+						if (i < n) {
+							if (prev == EntityTraits::INVALID_INDEX) head = i;
+							else entities[prev] = ComposeEntity(i, EntityToVersion(entities[prev]));
+							prev = i;
+						}
+						i = next;
+					}
+					if (prev != EntityTraits::INVALID_INDEX)
+						entities[prev] = ComposeEntity(EntityTraits::INVALID_INDEX, EntityToVersion(entities[prev]));
+					fNext = head;
+					fTail = prev;
+				}
+				fSize -= static_cast<uint32_t>(entities.size() - n);
+				entities.resize(n);
+				if constexpr (IsDirect) alive.resize((n + 63) / 64);
+			}
+			entities.shrink_to_fit();
+			if constexpr (IsDirect) alive.shrink_to_fit();
+			return n;
+		}
+
+		void ResetEntities() noexcept {
+			entities.clear();
+			alive.clear();
+			freeIndices.clear();
+			fNext = EntityTraits::INVALID_INDEX;
+			fTail = EntityTraits::INVALID_INDEX;
+			fSize = 0;
+			regrowLimit = 0;
+			regrowVersion = 0;
+		}
+
+		struct CloneTag {};
+		struct ForkTag {};
+
+		Registry(CloneTag, const Registry& src, size_t threads)
+			: Registry()
+		{
+			entities      = CloneColumn(src.entities);
+			fNext         = src.fNext;
+			fTail         = src.fTail;
+			fSize         = src.fSize;
+			regrowLimit   = src.regrowLimit;
+			regrowVersion = src.regrowVersion;
+			alive         = src.alive;
+			freeIndices   = src.freeIndices;
+			parallel_for(NUM_COMPONENTS, threads, [this, &src](size_t, size_t begin, size_t end) {
+				for (size_t i = begin; i < end; ++i) {
+					[&]<size_t... Is>(std::index_sequence<Is...>) {
+						((i == Is ? std::get<Is>(storages).CopyFrom(std::get<Is>(src.storages)) : void()), ...);
+					}(std::make_index_sequence<NUM_COMPONENTS>{});
+				}
+			});
+		}
+
+		Registry(ForkTag, Registry& src)
+			: Registry()
+		{
+			entities      = ForkColumn(src.entities);
+			fNext         = src.fNext;
+			fTail         = src.fTail;
+			fSize         = src.fSize;
+			regrowLimit   = src.regrowLimit;
+			regrowVersion = src.regrowVersion;
+			alive         = src.alive;
+			freeIndices   = src.freeIndices;
+			[&]<size_t... Is>(std::index_sequence<Is...>) {
+				(std::get<Is>(storages).ForkFrom(std::get<Is>(src.storages)), ...);
+			}(std::make_index_sequence<NUM_COMPONENTS>{});
+		}
+
+		void CreateEntitiesImpl(std::span<Entity> out, size_t threads) {
+			size_t allocated = 0;
+			try {
+				for (; allocated < out.size(); ++allocated)
+					out[allocated] = AllocateEntity();
+			}
+			catch (...) {
+				while (allocated > 0)
+					ReleaseEntity(EntityToIndex(out[--allocated]));
+				throw;
+			}
+
+			const std::span<const Entity> batch(out);
+			parallel_for_each_tuple([batch](auto& s) { s.InitMany(batch); }, storages, threads);
+		}
+
+		void DestroyEntitiesImpl(std::span<const Entity> batch, size_t threads) {
+			// Releasing each id as it is checked makes a repeated entity stale,
+			// so it is rejected like any other invalid one.
+			std::vector<Entity::IdType> indices;
+			indices.reserve(batch.size());
+			std::exception_ptr error;
+			try {
+				for (const Entity e : batch) {
+					CheckEntity(e);
+					indices.push_back(EntityToIndex(e));
+					ReleaseEntity(indices.back());
+				}
+			}
+			catch (...) {
+				error = std::current_exception();
+			}
+
+			const std::span<const Entity::IdType> released(indices);
+			parallel_for_each_tuple([released](auto& s) { s.KillMany(released); }, storages, threads);
+			if (error) std::rethrow_exception(error);
+		}
+
 		template <typename T>
 		static void ValidateChunk() {
 			static_assert(
-				IsContiguous || std::has_single_bit(CHUNK_SIZE),
+				IsContiguous || std::has_single_bit(ChunkSize),
 				"CHUNK_SIZE must be a power of two (or 0 for contiguous storage)");
+			static_assert(
+				!IsDirect || IsContiguous || ChunkSize >= 64,
+				"ColumnLayout::Direct requires CHUNK_SIZE >= 64 so chunks cover whole alive-bitmap words");
 		}
 
 		template <typename T>
@@ -736,16 +3516,36 @@ namespace entable {
 	private:
 		static constexpr size_t NUM_COMPONENTS = sizeof...(Cs);
 
-		// Entities storage type - vector if contiguous, ChunkedArray otherwise
-		using EntitiesStorage = std::conditional_t<IsContiguous, std::vector<Entity>, ChunkedArray<Entity, CHUNK_SIZE>>;
+		// Entities storage type - VirtualArray if contiguous, ChunkedArray otherwise
+		using EntitiesStorage = std::conditional_t<IsContiguous, ContiguousArray<Entity>,
+			ChunkedArray<Entity, ChunkSize, DEFAULT_CHUNK_ALIGN, false, CopyOnWrite>>;
+		// One bit per entity index, set while the entity is live (direct layout only)
+		using AliveBitmap = std::conditional_t<IsDirect, std::vector<uint64_t>, NoIndexStorage>;
+		using FreeIndexStorage = std::conditional_t<FreeList == FreeListPolicy::LowestIndex, FreeIndexSet, NoIndexStorage>;
 
 	public:
 		EntitiesStorage entities;
 		uint32_t        fNext = EntityTraits::INVALID_INDEX;
+		uint32_t        fTail = EntityTraits::INVALID_INDEX;
 		uint32_t        fSize = 0;
+		// Indices below regrowLimit were trimmed once and restart at regrowVersion.
+		uint32_t        regrowLimit = 0;
+		uint32_t        regrowVersion = 0;
 		StoragesTuple   storages;
+		[[no_unique_address]] AliveBitmap alive;
+		[[no_unique_address]] FreeIndexStorage freeIndices;
 	};
 
 	template<typename... Cs>
 	using RegistryWithDefaultChunkSize = Registry<DEFAULT_DENSE_CHUNK_SIZE, Cs...>;
 }
+
+// Structured bindings over SplitReference proxies: one reference per member.
+template <typename T, bool IsConst>
+struct std::tuple_size<entable::SplitReference<T, IsConst>>
+	: std::integral_constant<size_t, entable::AggregateFields<T>::Count> {};
+
+template <size_t I, typename T, bool IsConst>
+struct std::tuple_element<I, entable::SplitReference<T, IsConst>> {
+	using type = std::tuple_element_t<I, typename entable::SplitReference<T, IsConst>::Refs>;
+};
@@ -0,0 +1,557 @@
+#pragma once
+
+#include "ChunkedArray.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace entable {
+
+    // Chunked array with order-preserving insert and erase, for sorted
+    // columns (entities by spatial key, timers by deadline, ...).
+    //
+    // Unlike ChunkedArray, chunks may be partially filled: each has an entry
+    // in a per-chunk count array, so that
+    //   - insert / erase shift elements only within one chunk, O(CHUNK_SIZE),
+    //     instead of moving the whole tail of the array;
+    //   - a full chunk is split in halves to make room, and a chunk whose
+    //     neighbour can absorb it (both together at most half a chunk) is
+    //     merged into it after an erase, so chunks stay at least a quarter
+    //     full on average;
+    //   - iteration stays span-based: for_each_chunk yields each chunk's
+    //     live elements as one contiguous span.
+    //
+    // Indexing by position finds the chunk with a binary search over cached
+    // chunk start offsets, O(log chunk count). The offsets after a modified
+    // chunk are refreshed on every insert / erase: O(chunk count) integer
+    // adds, far below the element moves a contiguous array would need.
+    //
+    // Insert and erase move elements within a chunk, so pointers and
+    // references to elements of the modified chunk (or of a split or merged
+    // one) are invalidated; elements of other chunks stay in place.
+    // T must be nothrow move constructible.
+    template <class T, size_t CHUNK_SIZE = 256, size_t CHUNK_ALIGN = DEFAULT_CHUNK_ALIGN>
+    class OrderedChunkedArray
+    {
+        static_assert(std::has_single_bit(CHUNK_ALIGN) && CHUNK_ALIGN <= 4096,
+            "CHUNK_ALIGN must be a power of two no larger than 4096");
+        static_assert(CHUNK_SIZE >= 4 && CHUNK_SIZE <= (size_t{1} << 31), "CHUNK_SIZE must be in [4, 2^31]");
+        static_assert(std::is_nothrow_move_constructible_v<T>, "OrderedChunkedArray requires a nothrow move constructible T");
+
+    public:
+        using value_type      = T;
+        using size_type       = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = const T&;
+        using pointer         = T*;
+        using const_pointer   = const T*;
+
+        static constexpr size_t chunk_size      = CHUNK_SIZE;
+        static constexpr size_t chunk_alignment = CHUNK_ALIGN > alignof(T) ? CHUNK_ALIGN : alignof(T);
+
+        // Bidirectional iterator walking chunk by chunk. Invalidated by any
+        // insert or erase.
+        template <bool IS_CONST>
+        class Iterator
+        {
+            using Array = std::conditional_t<IS_CONST, const OrderedChunkedArray, OrderedChunkedArray>;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = std::conditional_t<IS_CONST, const T*, T*>;
+            using reference         = std::conditional_t<IS_CONST, const T&, T&>;
+
+            Iterator() noexcept = default;
+            Iterator(Array* a, size_t c, size_t off) noexcept : arr(a), chunk(c), offset(off) {}
+            // iterator -> const_iterator
+            template <bool OTHER_CONST> requires (IS_CONST && !OTHER_CONST)
+            Iterator(const Iterator<OTHER_CONST>& other) noexcept
+                : arr(other.arr), chunk(other.chunk), offset(other.offset) {}
+
+            reference operator*() const noexcept { return arr->chunk_ptr(chunk)[offset]; }
+            pointer operator->() const noexcept { return arr->chunk_ptr(chunk) + offset; }
+
+            Iterator& operator++() noexcept {
+                if (++offset == arr->counts[chunk]) {
+                    ++chunk;
+                    offset = 0;
+                }
+                return *this;
+            }
+            Iterator operator++(int) noexcept { Iterator t = *this; ++*this; return t; }
+
+            Iterator& operator--() noexcept {
+                if (offset == 0) {
+                    --chunk;
+                    offset = arr->counts[chunk];
+                }
+                --offset;
+                return *this;
+            }
+            Iterator operator--(int) noexcept { Iterator t = *this; --*this; return t; }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+                return a.chunk == b.chunk && a.offset == b.offset;
+            }
+
+        private:
+            template <bool> friend class Iterator;
+
+            Array* arr{};
+            size_t chunk{};
+            size_t offset{};
+        };
+
+        using iterator       = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        // -----------------------------------------------------------------------
+        // Construction / destruction
+        // -----------------------------------------------------------------------
+
+        OrderedChunkedArray() = default;
+
+        ~OrderedChunkedArray() { clear(); }
+
+        OrderedChunkedArray(const OrderedChunkedArray&)            = delete;
+        OrderedChunkedArray& operator=(const OrderedChunkedArray&) = delete;
+
+        OrderedChunkedArray(OrderedChunkedArray&& other) noexcept
+            : chunks(std::move(other.chunks))
+            , counts(std::move(other.counts))
+            , starts(std::move(other.starts))
+            , elemCount(std::exchange(other.elemCount, 0))
+        {}
+
+        OrderedChunkedArray& operator=(OrderedChunkedArray&& other) noexcept {
+            if (this != &other) {
+                clear();
+                chunks    = std::move(other.chunks);
+                counts    = std::move(other.counts);
+                starts    = std::move(other.starts);
+                elemCount = std::exchange(other.elemCount, 0);
+            }
+            return *this;
+        }
+
+        // Explicit deep copy, chunk layout included.
+        [[nodiscard]] OrderedChunkedArray clone() const {
+            OrderedChunkedArray copy;
+            copy.chunks.reserve(chunks.size());
+            copy.counts.reserve(chunks.size());
+            copy.starts.reserve(chunks.size());
+            for (size_t c = 0; c < chunks.size(); ++c) {
+                ChunkPtr chunk = make_chunk();
+                std::uninitialized_copy_n(chunk_ptr(c), counts[c], chunk.get());
+                copy.chunks.push_back(std::move(chunk));
+                copy.counts.push_back(counts[c]);
+                copy.starts.push_back(starts[c]);
+                copy.elemCount += counts[c];
+            }
+            return copy;
+        }
+
+        // -----------------------------------------------------------------------
+        // Element access
+        // -----------------------------------------------------------------------
+
+        T& operator[](size_t idx) noexcept {
+            assert(idx < elemCount);
+            const auto [c, off] = locate(idx);
+            return chunk_ptr(c)[off];
+        }
+
+        const T& operator[](size_t idx) const noexcept {
+            assert(idx < elemCount);
+            const auto [c, off] = locate(idx);
+            return chunk_ptr(c)[off];
+        }
+
+        T& at(size_t idx) {
+            if (idx >= elemCount) throw std::out_of_range("OrderedChunkedArray::at");
+            return (*this)[idx];
+        }
+
+        const T& at(size_t idx) const {
+            if (idx >= elemCount) throw std::out_of_range("OrderedChunkedArray::at");
+            return (*this)[idx];
+        }
+
+        T&       front()       noexcept { assert(elemCount > 0); return chunk_ptr(0)[0]; }
+        const T& front() const noexcept { assert(elemCount > 0); return chunk_ptr(0)[0]; }
+        T&       back()        noexcept { assert(elemCount > 0); return chunk_ptr(chunks.size() - 1)[counts.back() - 1]; }
+        const T& back()  const noexcept { assert(elemCount > 0); return chunk_ptr(chunks.size() - 1)[counts.back() - 1]; }
+
+        iterator       begin()        noexcept { return iterator(this, 0, 0); }
+        iterator       end()          noexcept { return iterator(this, chunks.size(), 0); }
+        const_iterator begin()  const noexcept { return const_iterator(this, 0, 0); }
+        const_iterator end()    const noexcept { return const_iterator(this, chunks.size(), 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend()   const noexcept { return end(); }
+
+        // Iterator to position idx (<= size()), e.g. a lower_bound result.
+        iterator nth(size_t idx) noexcept {
+            if (idx == elemCount) return end();
+            const auto [c, off] = locate(idx);
+            return iterator(this, c, off);
+        }
+
+        const_iterator nth(size_t idx) const noexcept {
+            if (idx == elemCount) return end();
+            const auto [c, off] = locate(idx);
+            return const_iterator(this, c, off);
+        }
+
+        // Calls f(std::span<T>) for each chunk in order; no span is empty.
+        template<typename F>
+        void for_each_chunk(F&& f) {
+            for (size_t c = 0; c < chunks.size(); ++c)
+                f(std::span<T>(chunk_ptr(c), counts[c]));
+        }
+
+        template<typename F>
+        void for_each_chunk(F&& f) const {
+            for (size_t c = 0; c < chunks.size(); ++c)
+                f(std::span<const T>(chunk_ptr(c), counts[c]));
+        }
+
+        // -----------------------------------------------------------------------
+        // Sorted access
+        //
+        // For arrays kept sorted by comp: binary search over the chunks' last
+        // elements, then within one chunk. Positions are element indices.
+        // -----------------------------------------------------------------------
+
+        template <class K, class Compare = std::less<>>
+        [[nodiscard]] size_t lower_bound(const K& key, Compare comp = {}) const {
+            const size_t c = first_chunk_where([&](const T& last) { return !comp(last, key); });
+            if (c == chunks.size()) return elemCount;
+            const T* base = chunk_ptr(c);
+            return starts[c] + static_cast<size_t>(std::lower_bound(base, base + counts[c], key, comp) - base);
+        }
+
+        template <class K, class Compare = std::less<>>
+        [[nodiscard]] size_t upper_bound(const K& key, Compare comp = {}) const {
+            const size_t c = first_chunk_where([&](const T& last) { return comp(key, last); });
+            if (c == chunks.size()) return elemCount;
+            const T* base = chunk_ptr(c);
+            return starts[c] + static_cast<size_t>(std::upper_bound(base, base + counts[c], key, comp) - base);
+        }
+
+        // Inserts value after any equal elements; returns its position.
+        template <class Compare = std::less<>>
+        size_t insert_sorted(T value, Compare comp = {}) {
+            const size_t idx = upper_bound(value, comp);
+            emplace(idx, std::move(value));
+            return idx;
+        }
+
+        // -----------------------------------------------------------------------
+        // Capacity
+        // -----------------------------------------------------------------------
+
+        [[nodiscard]] bool   empty()       const noexcept { return elemCount == 0; }
+        [[nodiscard]] size_t size()        const noexcept { return elemCount; }
+        [[nodiscard]] size_t chunk_count() const noexcept { return chunks.size(); }
+
+        [[nodiscard]] ChunkedArrayStats memory_stats() const noexcept {
+            ChunkedArrayStats stats;
+            stats.allocated_bytes  = chunks.size() * CHUNK_SIZE * sizeof(T);
+            stats.live_bytes       = elemCount * sizeof(T);
+            stats.chunk_count      = chunks.size();
+            stats.live_chunk_count = chunks.size();
+            stats.index_bytes      = chunks.capacity() * sizeof(ChunkPtr)
+                                   + counts.capacity() * sizeof(uint32_t)
+                                   + starts.capacity() * sizeof(size_t);
+            return stats;
+        }
+
+        // -----------------------------------------------------------------------
+        // Modifiers
+        // -----------------------------------------------------------------------
+
+        void push_back(const T& value) { emplace(elemCount, value); }
+        void push_back(T&& value)      { emplace(elemCount, std::move(value)); }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args) { return emplace(elemCount, std::forward<Args>(args)...); }
+
+        void insert(size_t idx, const T& value) { emplace(idx, value); }
+        void insert(size_t idx, T&& value)      { emplace(idx, std::move(value)); }
+
+        // Constructs an element at position idx (<= size()), shifting the
+        // rest of its chunk up by one. If the element's constructor throws,
+        // the array is unchanged.
+        template<typename... Args>
+        T& emplace(size_t idx, Args&&... args) {
+            assert(idx <= elemCount);
+            T value(std::forward<Args>(args)...);
+            auto [c, off] = insert_position(idx);
+            T* base = chunk_ptr(c);
+            open_gap(base, off, counts[c]);
+            T* slot = ::new (static_cast<void*>(base + off)) T(std::move(value));
+            ++counts[c];
+            ++elemCount;
+            shift_starts(c + 1, 1);
+            return *slot;
+        }
+
+        void pop_back() noexcept {
+            assert(elemCount > 0);
+            erase(elemCount - 1);
+        }
+
+        void erase(size_t idx) noexcept { erase(idx, 1); }
+
+        // Erases [first, first + count): the chunks the range covers entirely
+        // are freed, the partially covered ones shift within themselves.
+        void erase(size_t first, size_t count) noexcept {
+            assert(first + count <= elemCount);
+            if (count == 0) return;
+            const auto [c0, off0] = locate(first);
+
+            size_t remaining = count;
+            const size_t n0 = std::min(remaining, counts[c0] - off0);
+            close_gap(chunk_ptr(c0), off0, n0, counts[c0]);
+            counts[c0] -= static_cast<uint32_t>(n0);
+            remaining -= n0;
+
+            size_t c = c0 + 1;
+            while (remaining > 0 && counts[c] <= remaining) {
+                std::destroy_n(chunk_ptr(c), counts[c]);
+                remaining -= counts[c];
+                ++c;
+            }
+            if (remaining > 0) {
+                close_gap(chunk_ptr(c), 0, remaining, counts[c]);
+                counts[c] -= static_cast<uint32_t>(remaining);
+            }
+            elemCount -= count;
+            if (c == c0 + 1 && remaining == 0) {
+                shift_starts(c0 + 1, 0 - count);
+            } else {
+                remove_chunks(c0 + 1, c);
+                refresh_starts(c0 + 1);
+            }
+
+            if (c0 + 1 < chunks.size())
+                rebalance(c0 + 1);
+            rebalance(c0);
+        }
+
+        // Destroys all elements and frees every chunk.
+        void clear() noexcept {
+            for (size_t c = 0; c < chunks.size(); ++c)
+                std::destroy_n(chunk_ptr(c), counts[c]);
+            chunks.clear();
+            counts.clear();
+            starts.clear();
+            elemCount = 0;
+        }
+
+    private:
+        struct ChunkDeleter {
+            void operator()(T* p) const noexcept {
+                ::operator delete(p, std::align_val_t{chunk_alignment});
+            }
+        };
+
+        using ChunkPtr = std::unique_ptr<T, ChunkDeleter>;
+
+        std::vector<ChunkPtr> chunks{};
+        // Live elements per chunk, never 0.
+        std::vector<uint32_t> counts{};
+        // Index of each chunk's first element: prefix sums of counts.
+        std::vector<size_t> starts{};
+        size_t elemCount{};
+
+        static ChunkPtr make_chunk() {
+            return ChunkPtr(static_cast<T*>(
+                ::operator new(sizeof(T) * CHUNK_SIZE, std::align_val_t{chunk_alignment})));
+        }
+
+        T* chunk_ptr(size_t c) const noexcept { return chunks[c].get(); }
+
+        // (chunk, offset) of element idx < size().
+        std::pair<size_t, size_t> locate(size_t idx) const noexcept {
+            const size_t c = static_cast<size_t>(std::upper_bound(starts.begin(), starts.end(), idx) - starts.begin()) - 1;
+            return {c, idx - starts[c]};
+        }
+
+        template <class Pred>
+        size_t first_chunk_where(Pred pred) const {
+            size_t lo = 0, hi = chunks.size();
+            while (lo < hi) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (pred(chunk_ptr(mid)[counts[mid] - 1])) hi = mid;
+                else lo = mid + 1;
+            }
+            return lo;
+        }
+
+        // Adds delta (wrapping, so "0 - n" subtracts) to the starts of chunks
+        // [from, end): independent adds the compiler vectorizes, unlike the
+        // prefix sum of refresh_starts.
+        void shift_starts(size_t from, size_t delta) noexcept {
+            for (size_t c = from; c < starts.size(); ++c)
+                starts[c] += delta;
+        }
+
+        // Recomputes the starts of chunks [from, end) after chunks were added,
+        // removed or resized.
+        void refresh_starts(size_t from) noexcept {
+            if (from == 0 && !starts.empty())
+                starts[0] = 0;
+            for (size_t c = std::max<size_t>(from, 1); c < starts.size(); ++c)
+                starts[c] = starts[c - 1] + counts[c - 1];
+        }
+
+        // Where an element inserted at idx goes, making room first: a new
+        // chunk at the end, or the back half of a full chunk split off.
+        // Between two chunks, the end of the first one is preferred when it
+        // has room, as nothing needs shifting there.
+        std::pair<size_t, size_t> insert_position(size_t idx) {
+            if (chunks.empty()) {
+                reserve_chunk_slot();
+                insert_chunk(0, make_chunk(), 0);
+                return {0, 0};
+            }
+            size_t c, off;
+            if (idx == elemCount) {
+                c = chunks.size() - 1;
+                off = counts[c];
+            } else {
+                std::tie(c, off) = locate(idx);
+                if (off == 0 && c > 0 && counts[c - 1] < CHUNK_SIZE) {
+                    --c;
+                    off = counts[c];
+                }
+            }
+            if (counts[c] < CHUNK_SIZE)
+                return {c, off};
+            if (off == CHUNK_SIZE) {
+                // Appending to a full last chunk: start a fresh one rather than
+                // splitting, so push_back fills chunks completely.
+                reserve_chunk_slot();
+                insert_chunk(c + 1, make_chunk(), 0);
+                return {c + 1, 0};
+            }
+            split(c);
+            if (off > counts[c])
+                return {c + 1, off - counts[c]};
+            return {c, off};
+        }
+
+        // Grows the chunk tables geometrically so that the next insert_chunk
+        // cannot throw, nor leave them with different sizes.
+        void reserve_chunk_slot() {
+            if (chunks.size() < chunks.capacity() && counts.size() < counts.capacity() && starts.size() < starts.capacity())
+                return;
+            const size_t n = std::max<size_t>(8, chunks.size() * 2);
+            chunks.reserve(n);
+            counts.reserve(n);
+            starts.reserve(n);
+        }
+
+        void insert_chunk(size_t c, ChunkPtr chunk, uint32_t count) noexcept {
+            assert(chunks.size() < chunks.capacity());
+            chunks.insert(chunks.begin() + static_cast<std::ptrdiff_t>(c), std::move(chunk));
+            counts.insert(counts.begin() + static_cast<std::ptrdiff_t>(c), count);
+            starts.insert(starts.begin() + static_cast<std::ptrdiff_t>(c), 0);
+            refresh_starts(c);
+        }
+
+        // Drops chunks [first, last), whose elements are already destroyed.
+        void remove_chunks(size_t first, size_t last) noexcept {
+            const auto f = static_cast<std::ptrdiff_t>(first), l = static_cast<std::ptrdiff_t>(last);
+            chunks.erase(chunks.begin() + f, chunks.begin() + l);
+            counts.erase(counts.begin() + f, counts.begin() + l);
+            starts.erase(starts.begin() + f, starts.begin() + l);
+        }
+
+        // Moves the back half of full chunk c into a new chunk after it.
+        void split(size_t c) {
+            reserve_chunk_slot();
+            ChunkPtr fresh = make_chunk();
+            constexpr size_t half = CHUNK_SIZE / 2;
+            relocate(chunk_ptr(c) + half, CHUNK_SIZE - half, fresh.get());
+            counts[c] = half;
+            insert_chunk(c + 1, std::move(fresh), CHUNK_SIZE - half);
+        }
+
+        // After an erase in chunk c: drops it if empty, else merges it with a
+        // neighbour when both fit in half a chunk.
+        void rebalance(size_t c) noexcept {
+            if (counts[c] == 0) {
+                remove_chunks(c, c + 1);
+                refresh_starts(c);
+                return;
+            }
+            if (c + 1 < chunks.size() && counts[c] + counts[c + 1] <= CHUNK_SIZE / 2)
+                merge_next(c);
+            else if (c > 0 && counts[c - 1] + counts[c] <= CHUNK_SIZE / 2)
+                merge_next(c - 1);
+        }
+
+        void merge_next(size_t c) noexcept {
+            relocate(chunk_ptr(c + 1), counts[c + 1], chunk_ptr(c) + counts[c]);
+            counts[c] += counts[c + 1];
+            remove_chunks(c + 1, c + 2);
+            refresh_starts(c + 1);
+        }
+
+        // Move-constructs n elements into uninitialised dst and destroys the sources.
+        static void relocate(T* src, size_t n, T* dst) noexcept {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (n > 0) std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+            } else {
+                for (size_t i = 0; i < n; ++i) {
+                    ::new (static_cast<void*>(dst + i)) T(std::move(src[i]));
+                    std::destroy_at(src + i);
+                }
+            }
+        }
+
+        // Shifts [off, count) up by one, leaving slot off uninitialised.
+        static void open_gap(T* base, size_t off, size_t count) noexcept {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memmove(static_cast<void*>(base + off + 1), base + off, (count - off) * sizeof(T));
+            } else {
+                for (size_t i = count; i > off; --i) {
+                    ::new (static_cast<void*>(base + i)) T(std::move(base[i - 1]));
+                    std::destroy_at(base + i - 1);
+                }
+            }
+        }
+
+        // Destroys [off, off + n) and shifts [off + n, count) down by n.
+        static void close_gap(T* base, size_t off, size_t n, size_t count) noexcept {
+            std::destroy_n(base + off, n);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memmove(static_cast<void*>(base + off), base + off + n, (count - off - n) * sizeof(T));
+            } else {
+                for (size_t i = off; i + n < count; ++i) {
+                    ::new (static_cast<void*>(base + i)) T(std::move(base[i + n]));
+                    std::destroy_at(base + i + n);
+                }
+            }
+        }
+    };
+}
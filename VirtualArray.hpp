@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+// The two kernel32 functions VirtualMemory needs, declared with the SDK's
+// signatures instead of including <windows.h> into every user of this header.
+// Including <windows.h> as well stays valid.
+namespace entable::win32 {
+    #if defined(_WIN64)
+    using SIZE_T = unsigned __int64;
+    #else
+    using SIZE_T = unsigned long;
+    #endif
+    // Values of the <windows.h> macros of the same names.
+    static constexpr unsigned long MemCommit     = 0x00001000;
+    static constexpr unsigned long MemReserve    = 0x00002000;
+    static constexpr unsigned long MemDecommit   = 0x00004000;
+    static constexpr unsigned long MemRelease    = 0x00008000;
+    static constexpr unsigned long PageNoAccess  = 0x01;
+    static constexpr unsigned long PageReadWrite = 0x04;
+    // Page size on every architecture Windows supports.
+    static constexpr size_t PageSize = 4096;
+}
+
+extern "C" {
+    __declspec(dllimport) void* __stdcall VirtualAlloc(void* lpAddress, entable::win32::SIZE_T dwSize, unsigned long flAllocationType, unsigned long flProtect);
+    __declspec(dllimport) int   __stdcall VirtualFree(void* lpAddress, entable::win32::SIZE_T dwSize, unsigned long dwFreeType);
+}
+#else
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+
+namespace entable {
+
+    // Page-granular address space: reserved ranges cost no memory until parts
+    // of them are committed.
+    struct VirtualMemory
+    {
+        // Unit of Commit / Decommit.
+        static size_t PageSize() noexcept {
+#if defined(_WIN32)
+            return win32::PageSize;
+#else
+            static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return pageSize;
+#endif
+        }
+
+        // Throws std::bad_alloc when the address space is exhausted.
+        static void* Reserve(size_t bytes) {
+#if defined(_WIN32)
+            void* p = ::VirtualAlloc(nullptr, bytes, win32::MemReserve, win32::PageNoAccess);
+            if (p == nullptr) throw std::bad_alloc();
+#else
+            void* p = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+#endif
+            return p;
+        }
+
+        static void Commit(void* p, size_t bytes) {
+#if defined(_WIN32)
+            if (::VirtualAlloc(p, bytes, win32::MemCommit, win32::PageReadWrite) == nullptr) throw std::bad_alloc();
+#else
+            if (mprotect(p, bytes, PROT_READ | PROT_WRITE) != 0) throw std::bad_alloc();
+#endif
+        }
+
+        // Returns the pages to the OS; the range stays reserved.
+        static void Decommit(void* p, size_t bytes) noexcept {
+#if defined(_WIN32)
+            ::VirtualFree(p, bytes, win32::MemDecommit);
+#else
+            madvise(p, bytes, MADV_DONTNEED);
+            mprotect(p, bytes, PROT_NONE);
+#endif
+        }
+
+        static void Release(void* p, [[maybe_unused]] size_t bytes) noexcept {
+#if defined(_WIN32)
+            ::VirtualFree(p, 0, win32::MemRelease);
+#else
+            munmap(p, bytes);
+#endif
+        }
+    };
+
+
+    // Default address space reserved per VirtualArray.
+    static constexpr size_t DEFAULT_VIRTUAL_RESERVE_BYTES = sizeof(void*) >= 8 ? size_t{1} << 35 : size_t{1} << 28;
+
+    // Smallest valid RESERVE_BYTES for a VirtualArray<T> of up to n elements.
+    template <class T>
+    constexpr size_t reserve_bytes_for(size_t n) noexcept {
+        constexpr size_t granule = 64 * 1024;
+        return std::max<size_t>(1, (n * sizeof(T) + granule - 1) / granule) * granule;
+    }
+
+
+    // Contiguous growable array with std::vector-like API that never moves its
+    // elements.
+    //
+    // RESERVE_BYTES of address space are reserved on first growth and pages are
+    // committed as the array grows, so:
+    //   - Growth never reallocates: no copy of existing elements, no 2x
+    //     transient peak, and pointers / references stay valid like in
+    //     ChunkedArray.
+    //   - The elements are one span, iterated like a std::vector.
+    //
+    // The price is a fixed maximum size, max_size() = RESERVE_BYTES / sizeof(T);
+    // growing past it throws std::length_error. Reserving costs address space
+    // only, so the default is generous on 64-bit targets.
+    template <class T, size_t RESERVE_BYTES = DEFAULT_VIRTUAL_RESERVE_BYTES>
+    class VirtualArray
+    {
+        static_assert(alignof(T) <= 4096, "VirtualArray elements must not be over-aligned beyond a page");
+        static_assert(RESERVE_BYTES % (64 * 1024) == 0, "RESERVE_BYTES must be a multiple of 64 KiB");
+
+    public:
+        using value_type      = T;
+        using size_type       = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = const T&;
+        using pointer         = T*;
+        using const_pointer   = const T*;
+        using iterator        = T*;
+        using const_iterator  = const T*;
+
+        VirtualArray() noexcept = default;
+        ~VirtualArray() { reset(); }
+
+        VirtualArray(const VirtualArray&)            = delete;
+        VirtualArray& operator=(const VirtualArray&) = delete;
+
+        VirtualArray(VirtualArray&& other) noexcept
+            : base(std::exchange(other.base, nullptr))
+            , elemCount(std::exchange(other.elemCount, 0))
+            , committedBytes(std::exchange(other.committedBytes, 0))
+        {}
+
+        VirtualArray& operator=(VirtualArray&& other) noexcept {
+            if (this != &other) {
+                reset();
+                base           = std::exchange(other.base, nullptr);
+                elemCount      = std::exchange(other.elemCount, 0);
+                committedBytes = std::exchange(other.committedBytes, 0);
+            }
+            return *this;
+        }
+
+        // Explicit deep copy into a fresh reservation, committing only the
+        // pages the elements need.
+        [[nodiscard]] VirtualArray clone() const {
+            VirtualArray copy;
+            copy.reserve(elemCount);
+            std::uninitialized_copy(begin(), end(), copy.base);
+            copy.elemCount = elemCount;
+            return copy;
+        }
+
+        // -----------------------------------------------------------------------
+        // Element access
+        // -----------------------------------------------------------------------
+
+        T&       operator[](size_t idx)       noexcept { assert(idx < elemCount); return base[idx]; }
+        const T& operator[](size_t idx) const noexcept { assert(idx < elemCount); return base[idx]; }
+
+        T& at(size_t idx) {
+            if (idx >= elemCount) throw std::out_of_range("VirtualArray::at");
+            return base[idx];
+        }
+
+        const T& at(size_t idx) const {
+            if (idx >= elemCount) throw std::out_of_range("VirtualArray::at");
+            return base[idx];
+        }
+
+        T&       back()       noexcept { assert(elemCount > 0); return base[elemCount - 1]; }
+        const T& back() const noexcept { assert(elemCount > 0); return base[elemCount - 1]; }
+
+        T*       data()       noexcept { return base; }
+        const T* data() const noexcept { return base; }
+
+        std::span<T>       span()       noexcept { return {base, elemCount}; }
+        std::span<const T> span() const noexcept { return {base, elemCount}; }
+
+        iterator       begin()        noexcept { return base; }
+        iterator       end()          noexcept { return base + elemCount; }
+        const_iterator begin()  const noexcept { return base; }
+        const_iterator end()    const noexcept { return base + elemCount; }
+        const_iterator cbegin() const noexcept { return base; }
+        const_iterator cend()   const noexcept { return base + elemCount; }
+
+        // -----------------------------------------------------------------------
+        // Capacity
+        // -----------------------------------------------------------------------
+
+        [[nodiscard]] bool   empty()    const noexcept { return elemCount == 0; }
+        [[nodiscard]] size_t size()     const noexcept { return elemCount; }
+        // Elements that fit in the committed pages.
+        [[nodiscard]] size_t capacity() const noexcept { return committedBytes / sizeof(T); }
+        [[nodiscard]] static constexpr size_t max_size() noexcept { return RESERVE_BYTES / sizeof(T); }
+        [[nodiscard]] size_t committed_bytes() const noexcept { return committedBytes; }
+
+        // Commits pages for n elements; never moves anything.
+        void reserve(size_t n) {
+            if (n > capacity())
+                commit(n);
+        }
+
+        // Decommits the pages past the last element; releases the whole
+        // reservation when empty.
+        void shrink_to_fit() noexcept {
+            if (elemCount == 0) {
+                release();
+                return;
+            }
+            const size_t keep = round_up(elemCount * sizeof(T));
+            if (keep < committedBytes) {
+                VirtualMemory::Decommit(reinterpret_cast<std::byte*>(base) + keep, committedBytes - keep);
+                committedBytes = keep;
+            }
+        }
+
+        // -----------------------------------------------------------------------
+        // Modifiers
+        // -----------------------------------------------------------------------
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value)      { emplace_back(std::move(value)); }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (elemCount == capacity()) [[unlikely]]
+                commit(elemCount + 1);
+            T* slot = ::new (static_cast<void*>(base + elemCount)) T(std::forward<Args>(args)...);
+            ++elemCount;
+            return *slot;
+        }
+
+        void pop_back() noexcept {
+            assert(elemCount > 0);
+            --elemCount;
+            std::destroy_at(base + elemCount);
+        }
+
+        // Grows with value-initialised elements, or destroys the tail.
+        void resize(size_t n) {
+            if (n <= elemCount) {
+                destroy_tail(n);
+                return;
+            }
+            reserve(n);
+            std::uninitialized_value_construct(base + elemCount, base + n);
+            elemCount = n;
+        }
+
+        void resize(size_t n, const T& value) {
+            if (n <= elemCount) {
+                destroy_tail(n);
+                return;
+            }
+            reserve(n);
+            std::uninitialized_fill(base + elemCount, base + n, value);
+            elemCount = n;
+        }
+
+        // Destroys all elements; committed pages are kept for reuse.
+        void clear() noexcept { destroy_tail(0); }
+
+        // Destroys all elements and releases the reservation.
+        void reset() noexcept { release(); }
+
+    private:
+        T*     base{};
+        size_t elemCount{};
+        size_t committedBytes{};
+
+        static size_t round_up(size_t bytes) noexcept {
+            const size_t page = VirtualMemory::PageSize();
+            return (bytes + page - 1) / page * page;
+        }
+
+        // Commits at least n elements, growing the committed range by half
+        // so that the number of system calls stays logarithmic.
+        void commit(size_t n) {
+            if (n > max_size()) throw std::length_error("VirtualArray: reservation exhausted");
+            if (base == nullptr)
+                base = static_cast<T*>(VirtualMemory::Reserve(RESERVE_BYTES));
+            const size_t target = std::min(RESERVE_BYTES,
+                round_up(std::max(n * sizeof(T), committedBytes + committedBytes / 2)));
+            VirtualMemory::Commit(reinterpret_cast<std::byte*>(base) + committedBytes, target - committedBytes);
+            committedBytes = target;
+        }
+
+        void destroy_tail(size_t n) noexcept {
+            std::destroy(base + n, base + elemCount);
+            elemCount = n;
+        }
+
+        void release() noexcept {
+            clear();
+            if (base != nullptr)
+                VirtualMemory::Release(base, RESERVE_BYTES);
+            base = nullptr;
+            committedBytes = 0;
+        }
+    };
+}
@@ -10,12 +10,6 @@
 #define FLECS_IMPLEMENTATION
 #include <flecs.h>
 
-// Provide a default UserConfig so Entable trait probes are well-formed for local benchmark types.
-namespace entable {
-    template <typename T>
-    struct UserConfig {};
-}
-
 #include <Entable.hpp>
 
 namespace ent = entable;
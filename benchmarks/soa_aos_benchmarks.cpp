@@ -2,9 +2,13 @@
 // Uses medium-sized components to keep AoS entity payload around 200-300 bytes.
 
 #include <benchmark/benchmark.h>
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <random>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <Entable.hpp>
@@ -23,6 +27,9 @@ struct C7 { double a = 0, b = 0, c = 0, d = 0; };
 struct C8 { double a = 0, b = 0, c = 0, d = 0; };
 
 using SoARegistry = ent::RegistryWithDefaultChunkSize<C1, C2, C3, C4, C5, C6, C7, C8>;
+using DirectSoARegistry = ent::Registry<
+    ent::RegistryOptions{ .chunkSize = ent::DEFAULT_DENSE_CHUNK_SIZE, .layout = ent::ColumnLayout::Direct },
+    C1, C2, C3, C4, C5, C6, C7, C8>;
 
 struct EntityData {
     C1 c1;
@@ -530,6 +537,332 @@ static void BM_AoS_BatchRead_AllFields(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations() * n * 8);
 }
 
+// --- Column reductions: same work as BM_SoA_BatchRead_1Component, span-at-a-time ---
+
+static void BM_SoA_Reduce_1Component(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    SoARegistry reg;
+    for (size_t i = 0; i < n; ++i) {
+        reg.CreateEntity();
+    }
+    double acc = 0.0;
+    for (auto _ : state) {
+        acc = reg.TransformReduce<C1>(0.0, std::plus<>{}, [](const C1& c) {
+            return c.a + c.b + c.c + c.d;
+        });
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_SoA_BatchRead_1Field(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    SoARegistry reg;
+    for (size_t i = 0; i < n; ++i) {
+        reg.CreateEntity();
+    }
+    double acc = 0.0;
+    for (auto _ : state) {
+        acc = 0.0;
+        reg.Each<C1>([&](const C1& c) {
+            acc += c.a;
+        });
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_SoA_Sum_1Field(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    SoARegistry reg;
+    for (size_t i = 0; i < n; ++i) {
+        reg.CreateEntity();
+    }
+    double acc = 0.0;
+    for (auto _ : state) {
+        acc = reg.Sum<C1>([](const C1& c) { return c.a; });
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_SoA_ParallelReduce_1Component(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    SoARegistry reg;
+    for (size_t i = 0; i < n; ++i) {
+        reg.CreateEntity();
+    }
+    double acc = 0.0;
+    for (auto _ : state) {
+        acc = reg.ParallelTransformReduce<C1>(0.0, std::plus<>{}, [](const C1& c) {
+            return c.a + c.b + c.c + c.d;
+        });
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// --- Random lookups by entity: packed (sparse -> dense hop) vs direct layout ---
+
+template <typename Reg>
+static void BM_SoA_RandomGet(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Reg reg;
+    std::vector<ent::Entity> entities;
+    entities.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        entities.push_back(reg.CreateEntity());
+    }
+    // Light churn so the packed layout's slots no longer match entity indices.
+    for (size_t i = 0; i < n; i += 8) {
+        reg.DestroyEntity(entities[i]);
+        entities[i] = reg.CreateEntity();
+    }
+    std::mt19937 rng(42);
+    std::shuffle(entities.begin(), entities.end(), rng);
+
+    double acc = 0.0;
+    for (auto _ : state) {
+        for (const ent::Entity e : entities) {
+            acc += std::as_const(reg).template Get<C1>(e).a;
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Network id lookups: a scan of the id column vs the IndexKey hash index.
+struct NetId { uint32_t value = 0; };
+struct IndexedNetId { uint32_t value = 0; };
+
+template <>
+struct ent::UserConfig<IndexedNetId> {
+    static uint32_t IndexKey(const IndexedNetId& id) noexcept { return id.value; }
+    static constexpr bool UniqueIndex = true;
+};
+
+template <typename Id>
+static void BM_SoA_FindByKey(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    ent::RegistryWithDefaultChunkSize<C1, Id> reg;
+    std::vector<uint32_t> keys;
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t key = static_cast<uint32_t>(i * 2654435761u | 1u);
+        reg.template Set<Id>(reg.CreateEntity(), key);
+        keys.push_back(key);
+    }
+    std::mt19937 rng(42);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    keys.resize(std::min<size_t>(keys.size(), 64));
+
+    const auto& creg = reg;
+    for (auto _ : state) {
+        for (const uint32_t key : keys) {
+            if constexpr (ent::HasIndexKey<Id>) {
+                benchmark::DoNotOptimize(creg.template FindBy<Id>(key));
+            } else {
+                // Dense slot of the match; mapping it back to an entity is not timed.
+                size_t slot = 0, match = 0;
+                for (const auto span : creg.template Components<Id>()) {
+                    for (const Id& id : span) {
+                        if (id.value == key) match = slot;
+                        ++slot;
+                    }
+                }
+                benchmark::DoNotOptimize(match);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Timer expiry: each tick finds the entities whose deadline passed and
+// re-arms them, by scanning the deadline column or through the OrderKey index.
+struct Deadline { uint32_t tick = 0; };
+struct OrderedDeadline { uint32_t tick = 0; };
+
+template <>
+struct ent::UserConfig<OrderedDeadline> {
+    static uint32_t OrderKey(const OrderedDeadline& d) noexcept { return d.tick; }
+};
+
+template <typename D>
+static void BM_SoA_ExpireTick(benchmark::State& state) {
+    constexpr uint32_t kPeriod = 1 << 16;  // ticks until a re-armed timer fires again
+    const size_t n = static_cast<size_t>(state.range(0));
+    ent::RegistryWithDefaultChunkSize<C1, D> reg;
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < n; ++i)
+        reg.template Set<D>(reg.CreateEntity(), 1 + static_cast<uint32_t>(rng() % kPeriod));
+
+    uint32_t now = 1;
+    std::vector<ent::Entity> expired;
+    for (auto _ : state) {
+        expired.clear();
+        if constexpr (ent::HasOrderKey<D>) {
+            reg.template RangeEach<D>(0u, now + 1, [&](ent::Entity e) { expired.push_back(e); });
+            for (const ent::Entity e : expired)
+                reg.template Set<D>(e, now + 1 + static_cast<uint32_t>(rng() % kPeriod));
+        } else {
+            reg.template Each<D>([&](D& d) {
+                if (d.tick <= now) {
+                    d.tick = now + 1 + static_cast<uint32_t>(rng() % kPeriod);
+                    expired.push_back(ent::NullEntity);
+                }
+            });
+        }
+        benchmark::DoNotOptimize(expired.data());
+        ++now;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_SoA_BatchRead_1Component_Direct(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    DirectSoARegistry reg;
+    std::vector<ent::Entity> entities;
+    for (size_t i = 0; i < n; ++i) {
+        entities.push_back(reg.CreateEntity());
+    }
+    for (size_t i = 0; i < n; i += 8) {
+        reg.DestroyEntity(entities[i]);
+    }
+    double acc = 0.0;
+    for (auto _ : state) {
+        std::as_const(reg).Each<C1>([&](const C1& c) {
+            acc += c.a + c.b + c.c + c.d;
+        });
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * reg.Size());
+}
+
+// --- Churn under each free-list policy ---
+// n live entities plus n/4 free indices; every iteration destroys and recreates
+// n random entities. Counters: highest version reached (version burn) and free
+// indices at the tail of `entities` (what a compaction could trim). The
+// follow-up lookup benchmark measures Get locality after the same churn.
+
+template <ent::FreeListPolicy Policy>
+using ChurnRegistry = ent::Registry<ent::RegistryOptions{ .freeList = Policy }, C1, C2, C3, C4>;
+
+template <typename Reg>
+static std::vector<ent::Entity> MakeChurnedRegistry(Reg& reg, size_t n, std::mt19937& rng) {
+    std::vector<ent::Entity> live;
+    for (size_t i = 0; i < n + n / 4; ++i) {
+        live.push_back(reg.CreateEntity());
+    }
+    std::shuffle(live.begin(), live.end(), rng);
+    for (size_t i = n; i < live.size(); ++i) {
+        reg.DestroyEntity(live[i]);
+    }
+    live.resize(n);
+    return live;
+}
+
+template <typename Reg>
+static void Churn(Reg& reg, std::vector<ent::Entity>& live, size_t ops, std::mt19937& rng) {
+    for (size_t i = 0; i < ops; ++i) {
+        const size_t k = rng() % live.size();
+        reg.DestroyEntity(live[k]);
+        live[k] = reg.CreateEntity();
+    }
+}
+
+template <typename Reg>
+static void ReportChurnCounters(benchmark::State& state, const Reg& reg) {
+    uint32_t maxVersion = 0;
+    size_t lastLive = 0;
+    for (size_t i = 0; i < reg.entities.size(); ++i) {
+        const ent::Entity e = reg.entities[i];
+        maxVersion = std::max(maxVersion, ent::EntityToVersion(e));
+        if (ent::EntityToIndex(e) == i) lastLive = i + 1;
+    }
+    state.counters["max_version"] = maxVersion;
+    state.counters["free_tail"] = static_cast<double>(reg.entities.size() - lastLive);
+}
+
+template <ent::FreeListPolicy Policy>
+static void BM_SoA_Churn(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    ChurnRegistry<Policy> reg;
+    std::mt19937 rng(42);
+    auto live = MakeChurnedRegistry(reg, n, rng);
+    for (auto _ : state) {
+        Churn(reg, live, n, rng);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    ReportChurnCounters(state, reg);
+}
+
+template <ent::FreeListPolicy Policy>
+static void BM_SoA_ChurnedRandomGet(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    ChurnRegistry<Policy> reg;
+    std::mt19937 rng(42);
+    auto live = MakeChurnedRegistry(reg, n, rng);
+    Churn(reg, live, 8 * n, rng);
+    std::shuffle(live.begin(), live.end(), rng);
+    double acc = 0.0;
+    for (auto _ : state) {
+        for (const ent::Entity e : live) {
+            acc += std::as_const(reg).template Get<C1>(e).a;
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    ReportChurnCounters(state, reg);
+}
+
+// --- Forking a world: Clone vs rebuilding it entity by entity ---
+
+template <int MODE>  // 0: rebuild, 1: Clone, 2: ParallelClone
+static void BM_SoA_Fork(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    SoARegistry reg;
+    std::vector<ent::Entity> entities(n);
+    reg.CreateEntities(entities);
+    for (auto _ : state) {
+        if constexpr (MODE == 0) {
+            SoARegistry copy;
+            for (const ent::Entity e : entities) {
+                const ent::Entity c = copy.CreateEntity();
+                copy.Get<C1>(c) = reg.Get<C1>(e); copy.Get<C2>(c) = reg.Get<C2>(e);
+                copy.Get<C3>(c) = reg.Get<C3>(e); copy.Get<C4>(c) = reg.Get<C4>(e);
+                copy.Get<C5>(c) = reg.Get<C5>(e); copy.Get<C6>(c) = reg.Get<C6>(e);
+                copy.Get<C7>(c) = reg.Get<C7>(e); copy.Get<C8>(c) = reg.Get<C8>(e);
+            }
+            benchmark::DoNotOptimize(copy.Size());
+        } else {
+            auto copy = MODE == 1 ? reg.Clone() : reg.ParallelClone();
+            benchmark::DoNotOptimize(copy.Size());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Copy-on-write fork followed by a speculative step that writes 1% of the
+// entities: only the touched chunks are copied.
+static void BM_SoA_ForkCopyOnWrite(benchmark::State& state) {
+    using CowRegistry = ent::Registry<
+        ent::RegistryOptions{ .chunkSize = ent::DEFAULT_DENSE_CHUNK_SIZE, .copyOnWrite = true },
+        C1, C2, C3, C4, C5, C6, C7, C8>;
+    const size_t n = static_cast<size_t>(state.range(0));
+    CowRegistry reg;
+    std::vector<ent::Entity> entities(n);
+    reg.CreateEntities(entities);
+    for (auto _ : state) {
+        auto fork = reg.Fork();
+        for (size_t i = 0; i < n; i += 100)
+            fork.Get<C1>(entities[i]).a += 1.0;
+        benchmark::DoNotOptimize(fork.Size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
 #define ARGS_ENTITY_COUNTS ->Arg(256)->Arg(1024)->Arg(4096)->Arg(16384)->Arg(65536)
 
 BENCHMARK(BM_SoA_CreateEntities) ARGS_ENTITY_COUNTS;
@@ -568,4 +901,29 @@ BENCHMARK(BM_AoS_BatchRead_4Fields) ARGS_ENTITY_COUNTS;
 BENCHMARK(BM_SoA_BatchRead_AllComponents) ARGS_ENTITY_COUNTS;
 BENCHMARK(BM_AoS_BatchRead_AllFields) ARGS_ENTITY_COUNTS;
 
+BENCHMARK(BM_SoA_Reduce_1Component) ARGS_ENTITY_COUNTS;
+BENCHMARK(BM_SoA_BatchRead_1Field) ARGS_ENTITY_COUNTS;
+BENCHMARK(BM_SoA_Sum_1Field) ARGS_ENTITY_COUNTS;
+BENCHMARK(BM_SoA_ParallelReduce_1Component) ARGS_ENTITY_COUNTS;
+
+BENCHMARK_TEMPLATE(BM_SoA_RandomGet, SoARegistry) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_RandomGet, DirectSoARegistry) ARGS_ENTITY_COUNTS;
+BENCHMARK(BM_SoA_BatchRead_1Component_Direct) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_FindByKey, NetId) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_FindByKey, IndexedNetId) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_ExpireTick, Deadline) ARGS_ENTITY_COUNTS->Arg(1 << 19);
+BENCHMARK_TEMPLATE(BM_SoA_ExpireTick, OrderedDeadline) ARGS_ENTITY_COUNTS->Arg(1 << 19);
+
+BENCHMARK_TEMPLATE(BM_SoA_Churn, ent::FreeListPolicy::Lifo) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_Churn, ent::FreeListPolicy::Fifo) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_Churn, ent::FreeListPolicy::LowestIndex) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_ChurnedRandomGet, ent::FreeListPolicy::Lifo) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_ChurnedRandomGet, ent::FreeListPolicy::Fifo) ARGS_ENTITY_COUNTS;
+BENCHMARK_TEMPLATE(BM_SoA_ChurnedRandomGet, ent::FreeListPolicy::LowestIndex) ARGS_ENTITY_COUNTS;
+
+BENCHMARK_TEMPLATE(BM_SoA_Fork, 0)->Arg(65536)->Arg(524288)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SoA_Fork, 1)->Arg(65536)->Arg(524288)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SoA_Fork, 2)->Arg(65536)->Arg(524288)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_SoA_ForkCopyOnWrite)->Arg(65536)->Arg(524288)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -3,10 +3,18 @@
 
 #include <benchmark/benchmark.h>
 #include <ChunkedArray.hpp>
+#include <ChunkedQueue.hpp>
+#include <ConcurrentChunkedArray.hpp>
+#include <OrderedChunkedArray.hpp>
 #include <algorithm>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 #include <numeric>
 #include <random>
+#include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace ent = entable;
@@ -278,6 +286,341 @@ static void BM_ChunkedArray_Back(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations() * n);
 }
 
+// --- Saxpy over chunk spans: natural vs cache-line aligned chunks ---
+// CHUNK_ALIGN = alignof(float) is the old allocation; 64 lets the loop use
+// aligned vector loads through assume_chunk_aligned().
+
+static void BM_Vector_Saxpy(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<float> x(n, 1.0f), y(n, 2.0f);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i)
+            y[i] = 1.5f * x[i] + y[i];
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <size_t ALIGN>
+static void BM_ChunkedArray_Saxpy(benchmark::State& state) {
+    using Array = ent::ChunkedArray<float, kChunkSize, ALIGN>;
+    size_t n = static_cast<size_t>(state.range(0));
+    Array x, y;
+    x.resize(n, 1.0f);
+    y.resize(n, 2.0f);
+    for (auto _ : state) {
+        y.for_each_chunk_indexed([&x](size_t c, std::span<float> chunk) {
+            float* __restrict yp = Array::assume_chunk_aligned(chunk.data());
+            const float* __restrict xp = x.get_chunk_ptr(c);
+            for (size_t i = 0; i < chunk.size(); ++i)
+                yp[i] = 1.5f * xp[i] + yp[i];
+        });
+        benchmark::DoNotOptimize(y.get_chunk_ptr(0));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_Vector_Saxpy)->Arg(1024)->Arg(16384)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_ChunkedArray_Saxpy, alignof(float))->Arg(1024)->Arg(16384)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_ChunkedArray_Saxpy, 64)->Arg(1024)->Arg(16384)->Arg(65536);
+
+// --- Many small lists: fixed vs geometrically grown first chunk ---
+
+template <bool GROW>
+static void BM_ChunkedArray_SmallLists(benchmark::State& state) {
+    using List = ent::ChunkedArray<int, kChunkSize, 64, GROW>;
+    const size_t perList = static_cast<size_t>(state.range(0));
+    constexpr size_t kLists = 4096;
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::vector<List> lists(kLists);
+        for (List& list : lists)
+            for (size_t i = 0; i < perList; ++i)
+                list.push_back(static_cast<int>(i));
+        state.PauseTiming();
+        bytes = 0;
+        for (const List& list : lists)
+            bytes += list.memory_stats().allocated_bytes;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(lists.data());
+    }
+    state.counters["bytes_per_list"] = static_cast<double>(bytes) / kLists;
+    state.SetItemsProcessed(state.iterations() * kLists * perList);
+}
+
+BENCHMARK_TEMPLATE(BM_ChunkedArray_SmallLists, false)->Arg(3)->Arg(40)->Arg(300);
+BENCHMARK_TEMPLATE(BM_ChunkedArray_SmallLists, true)->Arg(3)->Arg(40)->Arg(300);
+
+// --- Bulk import: push_back loop vs chunk-wise append_range ---
+
+template <bool BULK>
+static void BM_ChunkedArray_Import(benchmark::State& state) {
+    size_t n = static_cast<size_t>(state.range(0));
+    std::vector<int> source(n, 7);
+    for (auto _ : state) {
+        ent::ChunkedArray<int, kChunkSize> v;
+        if constexpr (BULK) {
+            v.append_range(source);
+        } else {
+            for (int value : source)
+                v.push_back(value);
+        }
+        benchmark::DoNotOptimize(n > 0 ? &v[0] : nullptr);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(int));
+}
+
+BENCHMARK_TEMPLATE(BM_ChunkedArray_Import, false)->Arg(4096)->Arg(65536)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ChunkedArray_Import, true)->Arg(4096)->Arg(65536)->Arg(1 << 20);
+
+// --- Algorithms: std:: on vector (0), std:: on ChunkedArray iterators (1),
+// entable:: segmented algorithm on ChunkedArray (2) ---
+
+enum AlgoMode { kVector, kIterator, kSegmented };
+
+template <int MODE, typename Fn>
+static void RunAlgorithm(benchmark::State& state, Fn&& fn) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<int> vec(n);
+    ent::ChunkedArray<int, kChunkSize> arr;
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < n; ++i) {
+        vec[i] = static_cast<int>(rng() % 100000);
+        arr.push_back(vec[i]);
+    }
+    for (auto _ : state) {
+        if constexpr (MODE == kVector) fn(vec, vec.begin(), vec.end());
+        else fn(arr, arr.begin(), arr.end());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <int MODE>
+static void BM_Algo_Fill(benchmark::State& state) {
+    RunAlgorithm<MODE>(state, [](auto& c, auto first, auto last) {
+        if constexpr (MODE == kSegmented) ent::fill(c, 3);
+        else std::fill(first, last, 3);
+    });
+}
+
+template <int MODE>
+static void BM_Algo_Copy(benchmark::State& state) {
+    std::vector<int> out(static_cast<size_t>(state.range(0)));
+    RunAlgorithm<MODE>(state, [&out](auto& c, auto first, auto last) {
+        if constexpr (MODE == kSegmented) ent::copy(c, out.begin());
+        else std::copy(first, last, out.begin());
+        benchmark::DoNotOptimize(out.data());
+    });
+}
+
+template <int MODE>
+static void BM_Algo_Transform(benchmark::State& state) {
+    RunAlgorithm<MODE>(state, [](auto& c, auto first, auto last) {
+        const auto op = [](int v) { return v * 3 + 1; };
+        if constexpr (MODE == kSegmented) ent::transform(c, c, op);
+        else std::transform(first, last, first, op);
+    });
+}
+
+template <int MODE>
+static void BM_Algo_Find(benchmark::State& state) {
+    RunAlgorithm<MODE>(state, [](auto& c, auto first, auto last) {
+        // Absent value: a full scan
+        if constexpr (MODE == kSegmented) benchmark::DoNotOptimize(ent::find(c, -1));
+        else benchmark::DoNotOptimize(std::find(first, last, -1));
+    });
+}
+
+template <int MODE>
+static void BM_Algo_CountIf(benchmark::State& state) {
+    RunAlgorithm<MODE>(state, [](auto& c, auto first, auto last) {
+        const auto pred = [](int v) { return v < 50000; };
+        if constexpr (MODE == kSegmented) benchmark::DoNotOptimize(ent::count_if(c, pred));
+        else benchmark::DoNotOptimize(std::count_if(first, last, pred));
+    });
+}
+
+template <int MODE>
+static void BM_Algo_Sort(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<int> source(n);
+    std::mt19937 rng(42);
+    for (int& v : source) v = static_cast<int>(rng());
+    std::vector<int> vec;
+    ent::ChunkedArray<int, kChunkSize> arr;
+    for (auto _ : state) {
+        state.PauseTiming();
+        vec = source;
+        arr.clear();
+        arr.append_range(source);
+        state.ResumeTiming();
+        if constexpr (MODE == kVector) std::sort(vec.begin(), vec.end());
+        else if constexpr (MODE == kIterator) std::sort(arr.begin(), arr.end());
+        else ent::sort(arr);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define REGISTER_ALGORITHM(Bench) \
+    BENCHMARK_TEMPLATE(Bench, kVector)->Arg(4096)->Arg(65536)->Arg(1 << 20); \
+    BENCHMARK_TEMPLATE(Bench, kIterator)->Arg(4096)->Arg(65536)->Arg(1 << 20); \
+    BENCHMARK_TEMPLATE(Bench, kSegmented)->Arg(4096)->Arg(65536)->Arg(1 << 20);
+
+REGISTER_ALGORITHM(BM_Algo_Fill)
+REGISTER_ALGORITHM(BM_Algo_Copy)
+REGISTER_ALGORITHM(BM_Algo_Transform)
+REGISTER_ALGORITHM(BM_Algo_Find)
+REGISTER_ALGORITHM(BM_Algo_CountIf)
+REGISTER_ALGORITHM(BM_Algo_Sort)
+
+// --- ParallelAppend: producer threads filling one shared event list ---
+
+enum { kMutexVector, kConcurrent, kConcurrentBatch };
+
+// Each iteration clears the list and lets state.range(1) threads append
+// state.range(0) elements in total, as a parallel system emitting events.
+// kConcurrentBatch gathers 64 events per thread and appends them as a block.
+template <int MODE>
+static void BM_ParallelAppend(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    const size_t threads = static_cast<size_t>(state.range(1));
+    std::vector<uint64_t> vec;
+    std::mutex mutex;
+    ent::ConcurrentChunkedArray<uint64_t, 1024> arr;
+    std::vector<std::thread> workers;
+    for (auto _ : state) {
+        vec.clear();
+        arr.clear();
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                uint64_t batch[64];
+                size_t batched = 0;
+                for (size_t i = t; i < n; i += threads) {
+                    if constexpr (MODE == kMutexVector) {
+                        std::lock_guard lock(mutex);
+                        vec.push_back(i);
+                    } else if constexpr (MODE == kConcurrent) {
+                        arr.push_back(i);
+                    } else {
+                        batch[batched++] = i;
+                        if (batched == 64) {
+                            arr.append_range(std::span(batch, batched));
+                            batched = 0;
+                        }
+                    }
+                }
+                if (batched > 0)
+                    arr.append_range(std::span(batch, batched));
+            });
+        }
+        for (auto& w : workers) w.join();
+        workers.clear();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(BM_ParallelAppend, kMutexVector)->Args({1 << 20, 1})->Args({1 << 20, 4})->Args({1 << 20, 8})->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ParallelAppend, kConcurrent)->Args({1 << 20, 1})->Args({1 << 20, 4})->Args({1 << 20, 8})->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ParallelAppend, kConcurrentBatch)->Args({1 << 20, 1})->Args({1 << 20, 4})->Args({1 << 20, 8})->UseRealTime();
+
+// --- Fifo: work queue holding state.range(0) messages, one in one out ---
+
+template <typename Queue>
+static void BM_Fifo_Steady(benchmark::State& state) {
+    const size_t depth = static_cast<size_t>(state.range(0));
+    Queue queue;
+    int64_t next = 0;
+    for (size_t i = 0; i < depth; ++i) queue.push_back(next++);
+    int64_t sum = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < 1024; ++i) {
+            queue.push_back(next++);
+            sum += queue.front();
+            queue.pop_front();
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+BENCHMARK_TEMPLATE(BM_Fifo_Steady, std::deque<int64_t>)->Arg(16)->Arg(4096)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Fifo_Steady, ent::ChunkedQueue<int64_t, kChunkSize>)->Arg(16)->Arg(4096)->Arg(65536);
+
+// --- SortedChurn: sorted column of state.range(0) keys, one random insert and erase per step ---
+
+static void BM_Vector_SortedChurn(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::mt19937 rng(42);
+    std::vector<uint32_t> vec;
+    for (size_t i = 0; i < n; ++i) vec.insert(std::upper_bound(vec.begin(), vec.end(), rng()), rng());
+    for (auto _ : state) {
+        const uint32_t key = rng();
+        vec.insert(std::upper_bound(vec.begin(), vec.end(), key), key);
+        vec.erase(vec.begin() + static_cast<std::ptrdiff_t>(rng() % vec.size()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_OrderedChunkedArray_SortedChurn(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::mt19937 rng(42);
+    ent::OrderedChunkedArray<uint32_t, kChunkSize> arr;
+    for (size_t i = 0; i < n; ++i) arr.insert_sorted(rng());
+    for (auto _ : state) {
+        arr.insert_sorted(rng());
+        arr.erase(rng() % arr.size());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Vector_SortedChurn)->Arg(1024)->Arg(65536)->Arg(1 << 20);
+BENCHMARK(BM_OrderedChunkedArray_SortedChurn)->Arg(1024)->Arg(65536)->Arg(1 << 20);
+
+// --- LowerBound: random lookups in a sorted column of state.range(0) keys ---
+
+enum { kSearchVector, kSearchIterator, kSearchChunked, kSearchKeyIndex };
+
+template <int MODE>
+static void BM_LowerBound(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::mt19937 rng(42);
+    std::vector<uint32_t> vec(n);
+    for (auto& v : vec) v = rng();
+    std::sort(vec.begin(), vec.end());
+    ent::ChunkedArray<uint32_t, kChunkSize> arr;
+    arr.append_range(vec);
+    const ent::ChunkKeyIndex<uint32_t> index(arr);
+    std::vector<uint32_t> keys(4096);
+    for (auto& k : keys) k = rng();
+
+    size_t sum = 0;
+    for (auto _ : state) {
+        for (uint32_t key : keys) {
+            if constexpr (MODE == kSearchVector)
+                sum += static_cast<size_t>(std::lower_bound(vec.begin(), vec.end(), key) - vec.begin());
+            else if constexpr (MODE == kSearchIterator)
+                sum += static_cast<size_t>(std::lower_bound(arr.cbegin(), arr.cend(), key) - arr.cbegin());
+            else if constexpr (MODE == kSearchChunked)
+                sum += static_cast<size_t>(ent::lower_bound(std::as_const(arr), key) - arr.cbegin());
+            else
+                sum += static_cast<size_t>(ent::lower_bound(std::as_const(arr), index, key) - arr.cbegin());
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_LowerBound, kSearchVector)->Arg(65536)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK_TEMPLATE(BM_LowerBound, kSearchIterator)->Arg(65536)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK_TEMPLATE(BM_LowerBound, kSearchChunked)->Arg(65536)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK_TEMPLATE(BM_LowerBound, kSearchKeyIndex)->Arg(65536)->Arg(1 << 20)->Arg(1 << 24);
+
 // --- Register benchmarks grouped by data type ---
 
 #define REGISTER_BENCHMARK_FOR_TYPE(Suite, Type) \
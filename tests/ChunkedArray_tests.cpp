@@ -3,6 +3,12 @@
 #include <catch2/catch_test_macros.hpp>
 #include <ChunkedArray.hpp>
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <ranges>
+#include <sstream>
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -318,6 +324,167 @@ TEST_CASE("ChunkedArray<int>: shrink_to_fit", "[ChunkedArray][non-empty][shrink_
     }
 }
 
+TEST_CASE("ChunkedArray<int>: memory_stats", "[ChunkedArray][non-empty][memory_stats]")
+{
+    ent::ChunkedArray<int, kChunkSize> chunked;
+
+    SECTION("Empty")
+    {
+        const ent::ChunkedArrayStats stats = chunked.memory_stats();
+        REQUIRE(stats.allocated_bytes == 0);
+        REQUIRE(stats.live_bytes == 0);
+        REQUIRE(stats.chunk_count == 0);
+        REQUIRE(stats.live_chunk_count == 0);
+    }
+
+    SECTION("Tracks live chunks separately from allocated ones")
+    {
+        for (int i = 0; i < 1000; ++i)
+            chunked.push_back(i);
+        auto stats = chunked.memory_stats();
+        REQUIRE(stats.allocated_bytes == 4 * kChunkSize * sizeof(int));
+        REQUIRE(stats.live_bytes == 1000 * sizeof(int));
+        REQUIRE(stats.chunk_count == 4);
+        REQUIRE(stats.live_chunk_count == 4);
+        REQUIRE(stats.index_bytes >= 4 * sizeof(void*));
+
+        for (int i = 0; i < 750; ++i)
+            chunked.pop_back();
+        stats = chunked.memory_stats();
+        REQUIRE(stats.chunk_count == 4);
+        REQUIRE(stats.live_chunk_count == 1);
+        REQUIRE(stats.live_bytes == 250 * sizeof(int));
+
+        chunked.shrink_to_fit();
+        stats = chunked.memory_stats();
+        REQUIRE(stats.chunk_count == 1);
+        REQUIRE(stats.allocated_bytes == kChunkSize * sizeof(int));
+    }
+
+    SECTION("Reserved chunks are allocated but not live")
+    {
+        chunked.reserve(3 * kChunkSize);
+        chunked.push_back(1);
+        const auto stats = chunked.memory_stats();
+        REQUIRE(stats.chunk_count == 3);
+        REQUIRE(stats.live_chunk_count == 1);
+    }
+}
+
+TEST_CASE("ChunkedArray: chunks start on CHUNK_ALIGN boundaries", "[ChunkedArray][non-empty][alignment]")
+{
+    auto check = [](auto& arr) {
+        using Arr = std::remove_reference_t<decltype(arr)>;
+        for (int i = 0; i < 1000; ++i)
+            arr.push_back({});
+        size_t chunks = 0;
+        arr.for_each_chunk([&](auto chunk) {
+            REQUIRE(reinterpret_cast<std::uintptr_t>(chunk.data()) % Arr::chunk_alignment == 0);
+            REQUIRE(Arr::assume_chunk_aligned(chunk.data()) == chunk.data());
+            ++chunks;
+        });
+        REQUIRE(chunks == arr.chunk_count());
+        for (size_t c = 0; c < arr.chunk_count(); ++c)
+            REQUIRE(reinterpret_cast<std::uintptr_t>(arr.get_chunk_ptr(c)) % Arr::chunk_alignment == 0);
+    };
+
+    SECTION("Cache line by default")
+    {
+        ent::ChunkedArray<float, 100 + 28> arr;
+        STATIC_REQUIRE(decltype(arr)::chunk_alignment == 64);
+        check(arr);
+    }
+
+    SECTION("Page alignment")
+    {
+        ent::ChunkedArray<float, 64, 4096> arr;
+        check(arr);
+    }
+
+    SECTION("Never below alignof(T)")
+    {
+        struct alignas(128) Wide { float v[4]; };
+        ent::ChunkedArray<Wide, 16, 16> arr;
+        STATIC_REQUIRE(decltype(arr)::chunk_alignment == 128);
+        check(arr);
+    }
+}
+
+TEST_CASE("ChunkedArray: GROW_FIRST_CHUNK grows the first chunk geometrically", "[ChunkedArray][non-empty][grow_first_chunk]")
+{
+    using Small = ent::ChunkedArray<int, kChunkSize, 64, true>;
+    Small arr;
+
+    SECTION("Capacity doubles from 8 up to CHUNK_SIZE, then adds chunks")
+    {
+        REQUIRE(arr.capacity() == 0);
+        for (int i = 0; i < 3; ++i)
+            arr.push_back(i);
+        REQUIRE(arr.capacity() == 8);
+        REQUIRE(arr.memory_stats().allocated_bytes == 8 * sizeof(int));
+
+        for (int i = 3; i < 1000; ++i) {
+            arr.push_back(i);
+            const size_t n = arr.size();
+            const size_t expected = n <= 8 ? 8
+                : n <= kChunkSize ? std::bit_ceil(n)
+                : (n + kChunkSize - 1) / kChunkSize * kChunkSize;
+            REQUIRE(arr.capacity() == expected);
+        }
+        REQUIRE(arr.capacity() == 4 * kChunkSize);
+        REQUIRE(arr.chunk_count() == 4);
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE(arr[i] == i);
+    }
+
+    SECTION("reserve and resize size the first chunk")
+    {
+        arr.reserve(20);
+        REQUIRE(arr.capacity() == 32);
+        REQUIRE(arr.empty());
+        arr.resize(40, 7);
+        REQUIRE(arr.capacity() == 64);
+        REQUIRE(arr[39] == 7);
+        arr.resize(300);
+        REQUIRE(arr.capacity() == 2 * kChunkSize);
+        REQUIRE(arr[39] == 7);
+        REQUIRE(arr.size() == 300);
+    }
+
+    SECTION("shrink_to_fit returns a lone first chunk to the smallest step")
+    {
+        for (int i = 0; i < 300; ++i)
+            arr.push_back(i);
+        while (arr.size() > 5)
+            arr.pop_back();
+        arr.shrink_to_fit();
+        REQUIRE(arr.chunk_count() == 1);
+        REQUIRE(arr.capacity() == 8);
+        for (int i = 0; i < 5; ++i)
+            REQUIRE(arr[i] == i);
+
+        arr.push_back(5);
+        REQUIRE(arr.back() == 5);
+        arr.clear();
+        REQUIRE(arr.capacity() == 0);
+    }
+
+    SECTION("Non-trivial elements survive first-chunk growth")
+    {
+        ent::ChunkedArray<std::string, 64, 64, true> names;
+        for (int i = 0; i < 100; ++i)
+            names.emplace_back(std::to_string(i) + std::string(20, 'x'));
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(names[i] == std::to_string(i) + std::string(20, 'x'));
+        size_t visited = 0;
+        for (const auto& n : names) {
+            REQUIRE(n.size() >= 21);
+            ++visited;
+        }
+        REQUIRE(visited == 100);
+    }
+}
+
 TEST_CASE("ChunkedArray<int>: back() and pop_back()", "[ChunkedArray][non-empty][back][pop_back]")
 {
     ent::ChunkedArray<int, kChunkSize> chunked;
@@ -769,6 +936,399 @@ TEST_CASE("ChunkedArray<int>: resize()", "[ChunkedArray][non-empty][resize]")
     }
 }
 
+// =============================================================================
+// Bulk append / assign
+// =============================================================================
+
+namespace {
+    // Copy constructor throws once the shared budget runs out.
+    struct ThrowOnCopy {
+        explicit ThrowOnCopy(int v) : value(v) { ++s_live; }
+        ThrowOnCopy(const ThrowOnCopy& o) : value(o.value) {
+            if (s_budget-- == 0) throw std::runtime_error("copy budget exhausted");
+            ++s_live;
+        }
+        ~ThrowOnCopy() { --s_live; }
+
+        int value;
+        static inline int s_budget = 0;
+        static inline int s_live   = 0;
+    };
+}
+
+TEST_CASE("ChunkedArray<int>: append_range, append_n and assign", "[ChunkedArray][non-empty][append_range]")
+{
+    ent::ChunkedArray<int, kChunkSize> chunked;
+    std::vector<int> reference;
+
+    SECTION("append_range from a vector spans several chunks")
+    {
+        std::vector<int> source(kChunkSize * 3 + 17);
+        for (size_t i = 0; i < source.size(); ++i) source[i] = static_cast<int>(i);
+        chunked.push_back(-1);
+        chunked.append_range(source);
+        REQUIRE(chunked.size() == source.size() + 1);
+        REQUIRE(chunked.chunk_count() == 4);
+        REQUIRE(chunked[0] == -1);
+        for (size_t i = 0; i < source.size(); ++i) REQUIRE(chunked[i + 1] == source[i]);
+
+        chunked.push_back(12345);  // write pointer continues after the bulk append
+        REQUIRE(chunked.back() == 12345);
+        REQUIRE(chunked.size() == source.size() + 2);
+    }
+
+    SECTION("append_range from non-contiguous and single-pass ranges")
+    {
+        const std::list<int> list{ 1, 2, 3, 4, 5 };
+        chunked.append_range(list);
+        chunked.append_range(std::views::iota(0, 600) | std::views::filter([](int v) { return v % 2 == 0; }));
+        std::istringstream stream("7 8 9");
+        chunked.append_range(std::views::istream<int>(stream));
+
+        reference.assign(list.begin(), list.end());
+        for (int v = 0; v < 600; v += 2) reference.push_back(v);
+        reference.insert(reference.end(), { 7, 8, 9 });
+        REQUIRE(std::equal(chunked.begin(), chunked.end(), reference.begin(), reference.end()));
+    }
+
+    SECTION("append_n fills across chunk boundaries")
+    {
+        chunked.append_n(kChunkSize - 1, 3);
+        chunked.append_n(kChunkSize + 2, 4);
+        chunked.append_n(0, 5);
+        REQUIRE(chunked.size() == kChunkSize * 2 + 1);
+        REQUIRE(chunked[kChunkSize - 2] == 3);
+        REQUIRE(chunked[kChunkSize - 1] == 4);
+        REQUIRE(chunked[kChunkSize * 2] == 4);
+    }
+
+    SECTION("assign replaces contents and reuses chunks")
+    {
+        chunked.append_n(kChunkSize * 4, 1);
+        const int values[] = { 9, 8, 7 };
+        chunked.assign(std::begin(values), std::end(values));
+        REQUIRE(chunked.size() == 3);
+        REQUIRE(chunked.chunk_count() == 4);
+        REQUIRE(chunked[0] == 9);
+        REQUIRE(chunked[2] == 7);
+        chunked.push_back(6);
+        REQUIRE(chunked[3] == 6);
+    }
+
+    SECTION("non-trivial elements are copied")
+    {
+        ent::ChunkedArray<std::string, 4> strings;
+        const std::vector<std::string> source{ "a", "bb", std::string(40, 'c'), "d", "e", "f" };
+        strings.append_range(source);
+        strings.append_n(3, "g");
+        REQUIRE(strings.size() == 9);
+        REQUIRE(strings[2] == std::string(40, 'c'));
+        REQUIRE(strings[5] == "f");
+        REQUIRE(strings[8] == "g");
+    }
+}
+
+TEST_CASE("ChunkedArray: bulk append keeps the array unchanged on a throwing copy", "[ChunkedArray][append_range][exception]")
+{
+    {
+        ThrowOnCopy::s_budget = 100;
+        ent::ChunkedArray<ThrowOnCopy, 4> arr;
+        for (int i = 0; i < 3; ++i) arr.emplace_back(i);
+        std::vector<ThrowOnCopy> source;
+        for (int i = 0; i < 10; ++i) source.emplace_back(100 + i);
+        const int live_before = ThrowOnCopy::s_live;
+
+        ThrowOnCopy::s_budget = 6;  // fails in the middle of the second chunk being filled
+        REQUIRE_THROWS_AS(arr.append_range(source), std::runtime_error);
+        REQUIRE(arr.size() == 3);
+        REQUIRE(ThrowOnCopy::s_live == live_before);
+        REQUIRE(arr.back().value == 2);
+
+        ThrowOnCopy::s_budget = 2;
+        REQUIRE_THROWS_AS(arr.append_n(5, ThrowOnCopy(7)), std::runtime_error);
+        REQUIRE(arr.size() == 3);
+
+        // The array is still usable afterwards
+        ThrowOnCopy::s_budget = 100;
+        arr.append_range(source);
+        REQUIRE(arr.size() == 13);
+        REQUIRE(arr[12].value == 109);
+    }
+    REQUIRE(ThrowOnCopy::s_live == 0);
+}
+
+TEST_CASE("ChunkedArray: clone is a deep, independent copy", "[ChunkedArray][clone]")
+{
+    SECTION("trivially copyable elements")
+    {
+        ent::ChunkedArray<int, kChunkSize> arr;
+        for (int i = 0; i < static_cast<int>(kChunkSize) * 3 + 5; ++i) arr.push_back(i);
+        arr.reserve(kChunkSize * 10);
+
+        auto copy = arr.clone();
+        REQUIRE(copy.size() == arr.size());
+        REQUIRE(copy.chunk_count() == 4);  // surplus capacity is not copied
+        REQUIRE(std::equal(copy.begin(), copy.end(), arr.begin(), arr.end()));
+
+        copy[0] = -1;
+        copy.push_back(42);
+        REQUIRE(arr[0] == 0);
+        REQUIRE(copy.back() == 42);
+        REQUIRE(arr.size() == kChunkSize * 3 + 5);
+    }
+
+    SECTION("non-trivial elements and growing first chunk")
+    {
+        ent::ChunkedArray<std::string, 64, 64, true> arr;
+        for (int i = 0; i < 10; ++i) arr.push_back(std::string(30, static_cast<char>('a' + i)));
+        auto copy = arr.clone();
+        REQUIRE(copy.size() == 10);
+        REQUIRE(copy.capacity() <= arr.capacity());
+        REQUIRE(copy[9] == std::string(30, 'j'));
+        copy[9].clear();
+        REQUIRE(arr[9].size() == 30);
+    }
+
+    SECTION("empty")
+    {
+        ent::ChunkedArray<int, kChunkSize> arr;
+        auto copy = arr.clone();
+        REQUIRE(copy.empty());
+        REQUIRE(copy.chunk_count() == 0);
+    }
+}
+
+TEST_CASE("ChunkedArray: COPY_ON_WRITE forks share chunks until written", "[ChunkedArray][copy_on_write]")
+{
+    using Cow = ent::ChunkedArray<int, 64, 64, false, true>;
+    Cow arr;
+    for (int i = 0; i < 64 * 4 + 10; ++i) arr.push_back(i);   // 5 chunks, last one partial
+
+    Cow fork = arr.fork();
+    REQUIRE(fork.size() == arr.size());
+    REQUIRE(arr.shared_chunk_count() == 5);
+    REQUIRE(std::as_const(fork).get_chunk_ptr(2) == std::as_const(arr).get_chunk_ptr(2));
+
+    SECTION("const access never copies")
+    {
+        long sum = 0;
+        for (int v : std::as_const(fork)) sum += v;
+        std::as_const(fork).for_each_chunk([&](std::span<const int> c) { sum += c[0]; });
+        REQUIRE(sum > 0);
+        REQUIRE(fork.shared_chunk_count() == 5);
+    }
+
+    SECTION("a write copies only the touched chunk")
+    {
+        fork[130] = -1;
+        REQUIRE(fork.shared_chunk_count() == 4);
+        REQUIRE(arr.shared_chunk_count() == 4);
+        REQUIRE(fork[130] == -1);
+        REQUIRE(arr[130] == 130);
+        REQUIRE(fork[131] == 131);   // rest of the chunk was copied
+        REQUIRE(std::as_const(fork).get_chunk_ptr(0) == std::as_const(arr).get_chunk_ptr(0));
+
+        // The original writing to the same chunk now has it to itself
+        arr[129] = -2;
+        REQUIRE(arr.shared_chunk_count() == 4);
+        REQUIRE(fork[129] == 129);
+    }
+
+    SECTION("appending into a shared tail chunk detaches it")
+    {
+        fork.push_back(1000);
+        arr.push_back(2000);
+        REQUIRE(fork.back() == 1000);
+        REQUIRE(arr.back() == 2000);
+        REQUIRE(fork[64 * 4 + 9] == 64 * 4 + 9);
+        REQUIRE(fork.shared_chunk_count() == 4);
+
+        // pop_back then push_back on a shared chunk must not write into it
+        Cow fork2 = arr.fork();
+        fork2.pop_back();
+        fork2.pop_back();
+        fork2.push_back(-5);
+        REQUIRE(arr[64 * 4 + 9] == 64 * 4 + 9);
+        REQUIRE(arr.back() == 2000);
+        REQUIRE(fork2.back() == -5);
+    }
+
+    SECTION("mutable iteration and chunk spans copy chunk by chunk")
+    {
+        fork.for_each_chunk_indexed([](size_t c, std::span<int> chunk) {
+            if (c == 1) for (int& v : chunk) v = 0;
+        });
+        REQUIRE(fork.shared_chunk_count() == 0);  // every chunk was handed out writable
+        REQUIRE(arr[70] == 70);
+        REQUIRE(fork[70] == 0);
+
+        Cow fork2 = arr.fork();
+        for (int& v : fork2) v += 1;
+        REQUIRE(arr[0] == 0);
+        REQUIRE(fork2[0] == 1);
+        REQUIRE(fork2.back() == 64 * 4 + 10);
+    }
+
+    SECTION("destroying either side keeps the other intact")
+    {
+        {
+            Cow temp = arr.fork();
+            temp[0] = 5;
+        }
+        REQUIRE(arr.shared_chunk_count() == 5);  // still shared with `fork`
+        arr.clear();
+        REQUIRE(fork.shared_chunk_count() == 0);
+        REQUIRE(fork[64 * 4 + 9] == 64 * 4 + 9);
+    }
+}
+
+// =============================================================================
+// Segmented algorithms
+// =============================================================================
+
+TEST_CASE("ChunkedArray: segmented algorithms match std on vector", "[ChunkedArray][algorithms]")
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    ent::ChunkedArray<int, 64> arr;
+    std::vector<int> reference;
+    for (int i = 0; i < 64 * 9 + 13; ++i) {
+        const int v = dist(rng);
+        arr.push_back(v);
+        reference.push_back(v);
+    }
+
+    SECTION("fill")
+    {
+        ent::fill(arr, 7);
+        REQUIRE(std::all_of(arr.begin(), arr.end(), [](int v) { return v == 7; }));
+    }
+
+    SECTION("copy to an output iterator and to another ChunkedArray")
+    {
+        std::vector<int> out;
+        ent::copy(arr, std::back_inserter(out));
+        REQUIRE(out == reference);
+
+        // Different chunk sizes and a growing first chunk force split runs
+        ent::ChunkedArray<int, 16, 64, true> dst;
+        dst.resize(arr.size() + 5, -1);
+        ent::copy(arr, dst);
+        REQUIRE(std::equal(arr.begin(), arr.end(), dst.begin()));
+        REQUIRE(dst.back() == -1);
+    }
+
+    SECTION("transform")
+    {
+        std::vector<long> out(arr.size());
+        const auto end = ent::transform(arr, out.begin(), [](int v) { return static_cast<long>(v) * 2; });
+        REQUIRE(end == out.end());
+        for (size_t i = 0; i < out.size(); ++i) REQUIRE(out[i] == reference[i] * 2);
+
+        ent::ChunkedArray<long, 256> wide;
+        wide.resize(arr.size());
+        ent::transform(arr, wide, [](int v) { return static_cast<long>(v) - 1; });
+        REQUIRE(wide[arr.size() - 1] == reference.back() - 1);
+
+        ent::transform(arr, arr, [](int v) { return -v; });
+        REQUIRE(arr[100] == -reference[100]);
+    }
+
+    SECTION("find and count_if")
+    {
+        arr[64 * 5 + 3] = 5000;
+        arr[64 * 7] = 5000;
+        auto it = ent::find(arr, 5000);
+        REQUIRE(it - arr.begin() == 64 * 5 + 3);
+        *it = 0;
+        REQUIRE(ent::find(arr, 5000) - arr.begin() == 64 * 7);
+        REQUIRE(ent::find(std::as_const(arr), 12345) == arr.cend());
+
+        REQUIRE(ent::count_if(arr, [](int v) { return v < 0; })
+            == static_cast<size_t>(std::count_if(arr.begin(), arr.end(), [](int v) { return v < 0; })));
+    }
+
+    SECTION("sort")
+    {
+        ent::sort(arr);
+        std::sort(reference.begin(), reference.end());
+        REQUIRE(std::equal(arr.begin(), arr.end(), reference.begin(), reference.end()));
+
+        ent::sort(arr, std::greater<>{});
+        REQUIRE(std::is_sorted(arr.begin(), arr.end(), std::greater<>{}));
+
+        ent::ChunkedArray<std::string, 4> words;
+        for (const char* w : { "pear", "apple", "fig", "kiwi", "banana", "date", "cherry", "lime", "grape" })
+            words.push_back(w);
+        ent::sort(words);
+        REQUIRE(words[0] == "apple");
+        REQUIRE(words[8] == "pear");
+        REQUIRE(std::is_sorted(words.begin(), words.end()));
+
+        ent::ChunkedArray<int, 64> single;
+        for (int i = 5; i > 0; --i) single.push_back(i);
+        ent::sort(single);
+        REQUIRE(single[0] == 1);
+        REQUIRE(single[4] == 5);
+    }
+}
+
+TEST_CASE("ChunkedArray: chunk-indexed binary search matches std", "[ChunkedArray][algorithms][search]")
+{
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> dist(0, 400);
+    ent::ChunkedArray<int, 16> arr;
+    std::vector<int> reference;
+    for (int i = 0; i < 16 * 40 + 7; ++i) reference.push_back(dist(rng));
+    std::sort(reference.begin(), reference.end());  // plenty of duplicates spanning chunks
+    arr.append_range(reference);
+    const ent::ChunkKeyIndex<int> index(arr);
+    REQUIRE(index.size() == arr.chunk_count());
+
+    for (int key = -2; key <= 402; ++key) {
+        const auto lo = std::lower_bound(reference.begin(), reference.end(), key) - reference.begin();
+        const auto hi = std::upper_bound(reference.begin(), reference.end(), key) - reference.begin();
+        REQUIRE(ent::lower_bound(arr, key) - arr.begin() == lo);
+        REQUIRE(ent::upper_bound(arr, key) - arr.begin() == hi);
+        REQUIRE(ent::lower_bound(arr, index, key) - arr.begin() == lo);
+        REQUIRE(ent::upper_bound(arr, index, key) - arr.begin() == hi);
+        const auto [first, last] = ent::equal_range(arr, index, key);
+        REQUIRE(last - first == hi - lo);
+    }
+
+    SECTION("projection and comparator")
+    {
+        struct Event { uint32_t id; float payload; };
+        ent::ChunkedArray<Event, 8> events;
+        for (uint32_t id = 0; id < 200; id += 2) events.push_back({ id, static_cast<float>(id) * 0.5f });
+        const ent::ChunkKeyIndex<uint32_t> ids(events, &Event::id);
+
+        auto it = ent::lower_bound(events, ids, 84u, {}, &Event::id);
+        REQUIRE(it->id == 84);
+        REQUIRE(it->payload == 42.0f);
+        REQUIRE(ent::lower_bound(events, 85u, {}, &Event::id)->id == 86);
+        REQUIRE(ent::lower_bound(events, ids, 1000u, {}, &Event::id) == events.end());
+
+        ent::ChunkedArray<int, 4> descending;
+        for (int v = 20; v > 0; --v) descending.push_back(v);
+        REQUIRE(*ent::lower_bound(descending, 7, std::greater<>{}) == 7);
+        REQUIRE(*ent::upper_bound(descending, 7, std::greater<>{}) == 6);
+    }
+
+    SECTION("empty and single-chunk arrays")
+    {
+        ent::ChunkedArray<int, 16> empty;
+        REQUIRE(ent::lower_bound(empty, 3) == empty.end());
+        REQUIRE(ent::lower_bound(empty, ent::ChunkKeyIndex<int>(empty), 3) == empty.end());
+
+        ent::ChunkedArray<int, 64, 64, true> small;  // growing first chunk
+        for (int v : { 1, 3, 5 }) small.push_back(v);
+        REQUIRE(ent::lower_bound(small, 4) - small.begin() == 2);
+        REQUIRE(ent::upper_bound(small, 5) == small.end());
+        REQUIRE(ent::lower_bound(small, 0) == small.begin());
+    }
+}
+
 // =============================================================================
 // Iterator correctness: empty container
 // =============================================================================
@@ -0,0 +1,173 @@
+// Catch2 tests for ChunkedQueue correctness
+
+#include <catch2/catch_test_macros.hpp>
+#include <ChunkedQueue.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ent = entable;
+
+// Chunks are the only over-aligned allocations in these tests: counting the
+// aligned operator new counts chunk allocations.
+static size_t g_alignedAllocs = 0;
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    ++g_alignedAllocs;
+    if (void* p = std::aligned_alloc(static_cast<size_t>(align), (size + static_cast<size_t>(align) - 1) & ~(static_cast<size_t>(align) - 1)))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+TEST_CASE("ChunkedQueue<int>: FIFO order matches std::deque", "[ChunkedQueue][fifo]")
+{
+    ent::ChunkedQueue<int, 8> queue;
+    std::deque<int> reference;
+    REQUIRE(queue.empty());
+
+    std::mt19937 rng(7);
+    int next = 0;
+    for (int step = 0; step < 20000; ++step) {
+        const unsigned op = rng() % 10;
+        if (op < 5 || reference.empty()) {
+            queue.push_back(next);
+            reference.push_back(next++);
+        } else if (op < 9) {
+            REQUIRE(queue.front() == reference.front());
+            queue.pop_front();
+            reference.pop_front();
+        } else {
+            const size_t n = rng() % (reference.size() + 1);
+            queue.pop_front(n);
+            reference.erase(reference.begin(), reference.begin() + static_cast<std::ptrdiff_t>(n));
+        }
+        REQUIRE(queue.size() == reference.size());
+        if (!reference.empty()) {
+            REQUIRE(queue.front() == reference.front());
+            REQUIRE(queue.back() == reference.back());
+        }
+    }
+
+    REQUIRE(std::equal(queue.begin(), queue.end(), reference.begin(), reference.end()));
+    for (size_t i = 0; i < reference.size(); ++i)
+        REQUIRE(queue[i] == reference[i]);
+
+    // Chunk spans cover the queue in order, the first one starting at the head.
+    std::vector<int> flattened;
+    queue.for_each_chunk([&](std::span<const int> chunk) {
+        REQUIRE(!chunk.empty());
+        REQUIRE(chunk.size() <= 8);
+        flattened.insert(flattened.end(), chunk.begin(), chunk.end());
+    });
+    REQUIRE(std::equal(flattened.begin(), flattened.end(), reference.begin(), reference.end()));
+}
+
+TEST_CASE("ChunkedQueue: addresses stay stable while the head advances", "[ChunkedQueue][stability]")
+{
+    ent::ChunkedQueue<int, 4> queue;
+    for (int i = 0; i < 10; ++i) queue.push_back(i);
+    const int* seven = &queue[7];
+
+    for (int i = 0; i < 5; ++i) queue.pop_front();
+    for (int i = 10; i < 100; ++i) queue.push_back(i);  // the ring grows and wraps
+
+    REQUIRE(&queue[2] == seven);
+    REQUIRE(queue[2] == 7);
+    REQUIRE(*(queue.begin() + 2) == 7);
+}
+
+TEST_CASE("ChunkedQueue: steady state recycles chunks without allocating", "[ChunkedQueue][recycle]")
+{
+    ent::ChunkedQueue<int, 16> queue;
+    // Warm up to the high-water mark of 100 elements.
+    for (int i = 0; i < 100; ++i) queue.push_back(i);
+    for (int i = 0; i < 100; ++i) queue.pop_front();
+    const size_t chunks = queue.chunk_count();
+    REQUIRE(chunks >= 7);
+
+    const size_t before = g_alignedAllocs;
+    int next = 0, expected = 0;
+    for (int frame = 0; frame < 1000; ++frame) {
+        for (int i = 0; i < 90; ++i) queue.push_back(next++);
+        for (int i = 0; i < 90; ++i) {
+            REQUIRE(queue.front() == expected++);
+            queue.pop_front();
+        }
+    }
+    REQUIRE(g_alignedAllocs == before);
+    REQUIRE(queue.chunk_count() == chunks);
+
+    // Half-full queue sliding forward: the head keeps handing chunks to the tail.
+    for (int i = 0; i < 50; ++i) queue.push_back(next++);
+    for (int i = 0; i < 100000; ++i) {
+        queue.push_back(next++);
+        REQUIRE(queue.front() == expected++);
+        queue.pop_front();
+    }
+    REQUIRE(g_alignedAllocs == before);
+
+    SECTION("clear keeps chunks, shrink_to_fit releases them")
+    {
+        queue.clear();
+        REQUIRE(queue.empty());
+        REQUIRE(queue.chunk_count() == chunks);
+        queue.shrink_to_fit();
+        REQUIRE(queue.chunk_count() == 0);
+        REQUIRE(queue.memory_stats().index_bytes == 0);
+        queue.push_back(1);
+        REQUIRE(queue.front() == 1);
+        REQUIRE(queue.chunk_count() == 1);
+    }
+
+    SECTION("shrink_to_fit keeps the live chunks")
+    {
+        queue.pop_front(40);
+        queue.shrink_to_fit();
+        REQUIRE(queue.chunk_count() == queue.memory_stats().live_chunk_count);
+        for (size_t i = 0; i < queue.size(); ++i)
+            REQUIRE(queue[i] == expected + static_cast<int>(i) + 40);
+        queue.push_back(-1);
+        REQUIRE(queue.back() == -1);
+    }
+}
+
+TEST_CASE("ChunkedQueue<string>: non-trivial elements are destroyed", "[ChunkedQueue][non-trivial]")
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        ent::ChunkedQueue<std::shared_ptr<int>, 4> queue;
+        for (int i = 0; i < 30; ++i) queue.push_back(tracker);
+        REQUIRE(tracker.use_count() == 31);
+        queue.pop_front();
+        queue.pop_front(10);
+        REQUIRE(tracker.use_count() == 20);
+        queue.clear();
+        REQUIRE(tracker.use_count() == 1);
+        for (int i = 0; i < 9; ++i) queue.push_back(tracker);
+    }
+    REQUIRE(tracker.use_count() == 1);
+
+    ent::ChunkedQueue<std::string, 2> names;
+    names.emplace_back(40, 'x');
+    names.emplace_back("short");
+    names.emplace_back("third");
+    names.pop_front();
+    REQUIRE(names.front() == "short");
+
+    auto copy = names.clone();
+    names.pop_front();
+    REQUIRE(copy.size() == 2);
+    REQUIRE(copy.front() == "short");
+
+    ent::ChunkedQueue<std::string, 2> moved(std::move(copy));
+    REQUIRE(moved.back() == "third");
+    REQUIRE(copy.empty());
+}
@@ -0,0 +1,160 @@
+// Catch2 tests for ConcurrentChunkedArray correctness
+
+#include <catch2/catch_test_macros.hpp>
+#include <ConcurrentChunkedArray.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ent = entable;
+
+namespace {
+    // Producer id in the high half, sequence number in the low half.
+    constexpr uint64_t Tag(uint64_t thread, uint64_t seq) { return thread << 32 | seq; }
+}
+
+TEST_CASE("ConcurrentChunkedArray: single-threaded append and read", "[ConcurrentChunkedArray][append]")
+{
+    ent::ConcurrentChunkedArray<int, 16> arr(8);
+    REQUIRE(arr.empty());
+    REQUIRE(arr.capacity() == 128);
+    REQUIRE(arr.chunk_count() == 0);
+
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(arr.emplace_back(i) == static_cast<size_t>(i));
+
+    REQUIRE(arr.size() == 100);
+    REQUIRE(arr.chunk_count() == 7);
+    for (size_t i = 0; i < arr.size(); ++i)
+        REQUIRE(arr[i] == static_cast<int>(i));
+
+    size_t chunks = 0;
+    int expected = 0;
+    arr.for_each_chunk([&](std::span<const int> chunk) {
+        REQUIRE(chunk.size() == (chunks < 6 ? 16u : 4u));
+        for (int v : chunk) REQUIRE(v == expected++);
+        ++chunks;
+    });
+    REQUIRE(chunks == 7);
+
+    const std::vector<int> block{ 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013 };
+    REQUIRE(arr.append_range(block) == 100);
+    REQUIRE(arr.size() == 114);
+    REQUIRE(arr[111] == 1011);  // crosses the chunk boundary at 112
+    REQUIRE(arr[113] == 1013);
+
+    SECTION("clear keeps the chunks")
+    {
+        arr.clear();
+        REQUIRE(arr.empty());
+        REQUIRE(arr.chunk_count() == 8);
+        arr.push_back(42);
+        REQUIRE(arr[0] == 42);
+    }
+
+    SECTION("reset frees the chunks")
+    {
+        arr.reset();
+        REQUIRE(arr.empty());
+        REQUIRE(arr.chunk_count() == 0);
+    }
+}
+
+TEST_CASE("ConcurrentChunkedArray: capacity overflow throws", "[ConcurrentChunkedArray][capacity]")
+{
+    ent::ConcurrentChunkedArray<int, 8> arr(2);
+    arr.reserve(16);
+    REQUIRE(arr.chunk_count() == 2);
+    REQUIRE_THROWS_AS(arr.reserve(17), std::length_error);
+
+    for (int i = 0; i < 14; ++i) arr.push_back(i);
+    const std::vector<int> tooMany(3, 7);
+    REQUIRE_THROWS_AS(arr.append_range(tooMany), std::length_error);
+    REQUIRE_THROWS_AS(arr.push_back(99), std::length_error);
+    REQUIRE(arr.size() == 14);
+    REQUIRE(arr[13] == 13);
+
+    arr.clear();
+    REQUIRE(arr.push_back(5) == 0);
+}
+
+TEST_CASE("ConcurrentChunkedArray: non-trivial elements are destroyed", "[ConcurrentChunkedArray][non-trivial]")
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        ent::ConcurrentChunkedArray<std::shared_ptr<int>, 4> arr(16);
+        for (int i = 0; i < 10; ++i) arr.push_back(tracker);
+        REQUIRE(tracker.use_count() == 11);
+        arr.clear();
+        REQUIRE(tracker.use_count() == 1);
+        for (int i = 0; i < 5; ++i) arr.push_back(tracker);
+    }
+    REQUIRE(tracker.use_count() == 1);
+
+    ent::ConcurrentChunkedArray<std::string, 4> names(4);
+    names.emplace_back(40, 'x');
+    names.emplace_back("short");
+    REQUIRE(names[0] == std::string(40, 'x'));
+    REQUIRE(names[1] == "short");
+}
+
+TEST_CASE("ConcurrentChunkedArray: parallel producers", "[ConcurrentChunkedArray][threads]")
+{
+    constexpr uint64_t kThreads = 8;
+    constexpr uint64_t kPerThread = 20000;
+    ent::ConcurrentChunkedArray<uint64_t, 256> arr(1024);
+
+    // A reader polls the published size while the producers run: every
+    // published element must already hold a value some producer wrote.
+    std::atomic<bool> done{false};
+    std::atomic<bool> readerOk{true};
+    std::thread reader([&, &view = std::as_const(arr)] {
+        while (!done.load()) {
+            const size_t n = view.size();
+            for (size_t i = 0; i < n; ++i) {
+                if ((view[i] >> 32) >= kThreads || (view[i] & 0xFFFFFFFF) >= kPerThread) {
+                    readerOk = false;
+                    return;
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (uint64_t t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&, t] {
+            for (uint64_t i = 0; i < kPerThread; ) {
+                if (i % 7 == 0 && i + 3 <= kPerThread) {
+                    const uint64_t block[3] = { Tag(t, i), Tag(t, i + 1), Tag(t, i + 2) };
+                    arr.append_range(block);
+                    i += 3;
+                } else {
+                    arr.push_back(Tag(t, i++));
+                }
+            }
+        });
+    }
+    for (auto& p : producers) p.join();
+    done = true;
+    reader.join();
+    REQUIRE(readerOk);
+
+    REQUIRE(arr.size() == kThreads * kPerThread);
+
+    // Every value exactly once, and each producer's values in its own order.
+    std::vector<uint64_t> next(kThreads, 0);
+    arr.for_each([&](uint64_t v) {
+        const uint64_t t = v >> 32;
+        REQUIRE(t < kThreads);
+        REQUIRE((v & 0xFFFFFFFF) == next[t]);
+        ++next[t];
+    });
+    for (uint64_t t = 0; t < kThreads; ++t)
+        REQUIRE(next[t] == kPerThread);
+}
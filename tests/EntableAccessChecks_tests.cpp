@@ -0,0 +1,121 @@
+// Catch2 tests for Entable's conflicting-access detection
+// Built separately with ENTABLE_ACCESS_CHECKS=1; the main registry suite keeps
+// the default (unchecked) configuration.
+
+#define ENTABLE_ACCESS_CHECKS 1
+
+#include <catch2/catch_test_macros.hpp>
+#include <Entable.hpp>
+#include <stdexcept>
+
+namespace ent = entable;
+
+struct Position {
+    float x, y, z;
+    Position() : x(0), y(0), z(0) {}
+    Position(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+};
+
+struct Velocity {
+    float dx, dy, dz;
+    Velocity() : dx(0), dy(0), dz(0) {}
+    Velocity(float dx_, float dy_, float dz_) : dx(dx_), dy(dy_), dz(dz_) {}
+};
+
+using TestRegistry = ent::RegistryWithDefaultChunkSize<Position, Velocity>;
+
+static_assert(ent::ACCESS_CHECKS_ENABLED);
+
+
+TEST_CASE("AccessCounter: reader/writer conflict detection", "[AccessCounter]")
+{
+    ent::AccessCounter<true> counter;
+
+    SECTION("Multiple concurrent readers are allowed")
+    {
+        counter.BeginRead();
+        counter.BeginRead();
+        REQUIRE(counter.State() == 2);
+        counter.EndRead();
+        counter.EndRead();
+        REQUIRE(counter.State() == 0);
+    }
+
+    SECTION("Write during read is detected")
+    {
+        counter.BeginRead();
+        REQUIRE_THROWS_AS(counter.BeginWrite(), std::runtime_error);
+        counter.EndRead();
+        REQUIRE(counter.State() == 0);
+    }
+
+    SECTION("Read or write during write is detected")
+    {
+        counter.BeginWrite();
+        REQUIRE_THROWS_AS(counter.BeginRead(), std::runtime_error);
+        REQUIRE_THROWS_AS(counter.BeginWrite(), std::runtime_error);
+        counter.EndWrite();
+        REQUIRE(counter.State() == 0);
+    }
+
+    SECTION("Guards release on scope exit")
+    {
+        {
+            const ent::AccessGuard<true, true> guard(counter);
+            REQUIRE(counter.State() == -1);
+        }
+        REQUIRE(counter.State() == 0);
+    }
+}
+
+TEST_CASE("Registry: access checks detect conflicting column access", "[Registry][AccessChecks]")
+{
+    TestRegistry reg;
+    const auto e = reg.CreateEntity();
+    reg.CreateEntity();
+
+    SECTION("Disjoint columns may be accessed together")
+    {
+        reg.Each<Position>([&](Position&) {
+            REQUIRE_NOTHROW(reg.Set<Velocity>(e, 1.0f, 2.0f, 3.0f));
+        });
+        REQUIRE(reg.Get<Velocity>(e).dx == 1.0f);
+    }
+
+    SECTION("Shared reads through a const registry do not conflict")
+    {
+        const TestRegistry& creg = reg;
+        size_t visited = 0;
+        creg.Each<Position>([&](const Position&) {
+            creg.Each<Position, Velocity>([&](const Position&, const Velocity&) { ++visited; });
+        });
+        REQUIRE(visited == 4);
+    }
+
+    SECTION("Set on a column being iterated is detected")
+    {
+        REQUIRE_THROWS_AS(reg.Each<Position>([&](Position&) {
+            reg.Set<Position>(e, 1.0f, 2.0f, 3.0f);
+        }), std::runtime_error);
+
+        // Scopes unwound cleanly; the column is usable again.
+        REQUIRE_NOTHROW(reg.Set<Position>(e, 1.0f, 2.0f, 3.0f));
+    }
+
+    SECTION("Structural changes during iteration are detected")
+    {
+        REQUIRE_THROWS_AS(reg.Each<Velocity>([&](Velocity&) {
+            (void)reg.CreateEntity();
+        }), std::runtime_error);
+    }
+
+    SECTION("Explicit scopes guard references obtained from Get")
+    {
+        {
+            const auto scope = reg.ReadScope<Position>();
+            REQUIRE_THROWS_AS(reg.Set<Position>(e, 4.0f, 5.0f, 6.0f), std::runtime_error);
+            REQUIRE_NOTHROW(reg.Set<Velocity>(e, 4.0f, 5.0f, 6.0f));
+        }
+        REQUIRE_NOTHROW(reg.Set<Position>(e, 4.0f, 5.0f, 6.0f));
+    }
+}
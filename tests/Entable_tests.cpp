@@ -3,11 +3,15 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <Entable.hpp>
+#include <algorithm>
+#include <memory>
 #include <random>
 #include <set>
 #include <vector>
 #include <numeric>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace ent = entable;
 
@@ -26,6 +30,127 @@ struct Velocity {
 
 using TestRegistry = ent::RegistryWithDefaultChunkSize<Position, Velocity>;
 
+struct Health {
+    float value = 100.0f;
+};
+
+template <>
+struct ent::UserConfig<Health> {
+    static float SummaryKey(const Health& h) noexcept { return h.value; }
+};
+
+struct Transform {
+    float x = 0, y = 0, z = 0;
+    float qx = 0, qy = 0, qz = 0, qw = 1;
+};
+
+template <>
+struct ent::UserConfig<Transform> {
+    static constexpr bool SplitFields = true;
+};
+
+// Move-only, with a heap-owning member: swap-remove must move it, not copy.
+struct Owned {
+    std::unique_ptr<int> handle;
+    std::string name;
+};
+
+template <>
+struct ent::UserConfig<Owned> {
+    static constexpr bool SplitFields = true;
+};
+
+struct Body {
+    float mass = 1.0f;
+    std::vector<int> contacts;
+};
+
+template <>
+struct ent::UserConfig<Body> {
+    static constexpr bool StableAddresses = true;
+};
+
+struct Tag {
+    uint32_t id = 0;
+};
+
+template <>
+struct ent::UserConfig<Tag> {
+    static constexpr size_t ChunkBytes = 256;  // 64 per chunk
+};
+
+struct Inventory {
+    uint32_t id = 0;
+    char slots[508] = {};
+};
+
+template <>
+struct ent::UserConfig<Inventory> {
+    static constexpr size_t ChunkBytes = 4096;  // 8 per chunk
+};
+
+struct Fuel {
+    float value = 0.0f;
+};
+
+template <>
+struct ent::UserConfig<Fuel> {
+    static float SummaryKey(const Fuel& f) noexcept { return f.value; }
+    static constexpr size_t ChunkBytes = 256;  // 64 per chunk
+};
+
+enum class Visibility : uint8_t { Hidden, Shown };
+
+template <>
+struct ent::UserConfig<Visibility> {
+    static constexpr size_t PackedBits = 1;
+};
+
+enum class Team : uint8_t { None, Red, Blue, Green };
+
+template <>
+struct ent::UserConfig<Team> {
+    static constexpr size_t PackedBits = 2;
+};
+
+struct PlayerId {
+    uint32_t value = 0;
+};
+
+template <>
+struct ent::UserConfig<PlayerId> {
+    static uint32_t IndexKey(const PlayerId& p) noexcept { return p.value; }
+    static constexpr bool UniqueIndex = true;
+};
+
+struct Guild {
+    std::string name;
+};
+
+template <>
+struct ent::UserConfig<Guild> {
+    static const std::string& IndexKey(const Guild& g) noexcept { return g.name; }
+};
+
+struct ExpireTime {
+    uint32_t tick = 0;
+};
+
+template <>
+struct ent::UserConfig<ExpireTime> {
+    static uint32_t OrderKey(const ExpireTime& t) noexcept { return t.tick; }
+};
+
+struct Score {
+    int value = 0;
+};
+
+template <>
+struct ent::UserConfig<Score> {
+    static int OrderKey(const Score& s) noexcept { return s.value; }
+    static int IndexKey(const Score& s) noexcept { return s.value; }
+};
+
 // =============================================================================
 // Entity Creation Tests
 // =============================================================================
@@ -761,4 +886,1420 @@ TEST_CASE("Registry: ShrinkToFit reduces memory footprint", "[Registry][ShrinkTo
         auto& pos = reg.Get<Position>(e);
         REQUIRE(pos.x == 5.0f);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Registry: bulk and column-parallel create / destroy / clear", "[Registry][Bulk]")
+{
+    struct Name {
+        std::string value;
+    };
+    struct Samples {
+        std::vector<int> values;
+    };
+
+    using Reg = ent::Registry<size_t{64}, Position, Name, Samples>;
+    Reg reg;
+    const size_t threads = 3;
+
+    std::vector<ent::Entity> entities(1000);
+    reg.ParallelCreateEntities(entities, threads);
+    REQUIRE(reg.Size() == entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+        REQUIRE(reg.IsValidEntity(entities[i]));
+        REQUIRE(ent::EntityToIndex(entities[i]) == i);
+        reg.Set<Position>(entities[i], float(i), 0.0f, 0.0f);
+        reg.Set<Name>(entities[i], std::to_string(i));
+        reg.Set<Samples>(entities[i], std::vector<int>(8, int(i)));
+    }
+
+    SECTION("Destroying a batch keeps the survivors' components")
+    {
+        std::vector<ent::Entity> doomed;
+        for (size_t i = 0; i < entities.size(); i += 3)
+            doomed.push_back(entities[i]);
+        reg.ParallelDestroyEntities(doomed, threads);
+        REQUIRE(reg.Size() == entities.size() - doomed.size());
+
+        for (size_t i = 0; i < entities.size(); ++i) {
+            REQUIRE(reg.IsValidEntity(entities[i]) == (i % 3 != 0));
+            if (i % 3 == 0) continue;
+            REQUIRE(reg.Get<Position>(entities[i]).x == float(i));
+            REQUIRE(reg.Get<Name>(entities[i]).value == std::to_string(i));
+            REQUIRE(reg.Get<Samples>(entities[i]).values == std::vector<int>(8, int(i)));
+        }
+
+        // Ids are recycled in the same LIFO order as single DestroyEntity calls.
+        std::vector<ent::Entity> reborn(doomed.size());
+        reg.CreateEntities(reborn);
+        for (size_t i = 0; i < reborn.size(); ++i) {
+            REQUIRE(ent::EntityToIndex(reborn[i]) == ent::EntityToIndex(doomed[doomed.size() - 1 - i]));
+            REQUIRE(reg.Get<Name>(reborn[i]).value.empty());
+        }
+    }
+
+    SECTION("A repeated or stale entity stops the batch after destroying the ones before it")
+    {
+        const std::vector<ent::Entity> batch{ entities[0], entities[1], entities[0], entities[2] };
+        REQUIRE_THROWS_AS(reg.DestroyEntities(batch), std::runtime_error);
+        REQUIRE_FALSE(reg.IsValidEntity(entities[0]));
+        REQUIRE_FALSE(reg.IsValidEntity(entities[1]));
+        REQUIRE(reg.IsValidEntity(entities[2]));
+        REQUIRE(reg.Size() == entities.size() - 2);
+        REQUIRE(reg.Get<Name>(entities[999]).value == "999");
+    }
+
+    SECTION("ParallelClear / ParallelShrinkToFit")
+    {
+        reg.ParallelShrinkToFit(threads);
+        REQUIRE(reg.Get<Samples>(entities[500]).values.front() == 500);
+
+        reg.ParallelClear(threads);
+        REQUIRE(reg.Size() == 0);
+        REQUIRE_FALSE(reg.IsValidEntity(entities[0]));
+        REQUIRE(reg.CreateEntity() == ent::ComposeEntity(0, 0));
+    }
+}
+
+// =============================================================================
+// Filtered Iteration (EachWhere)
+// =============================================================================
+
+TEST_CASE("Registry: EachWhere skips chunks rejected by their summary", "[Registry][EachWhere]")
+{
+    using Reg = ent::Registry<256, Health, Position>;
+    Reg reg;
+
+    // 4 chunks of 256; only chunk 2 holds dead entities.
+    std::vector<ent::Entity> entities;
+    for (size_t i = 0; i < 1024; ++i) {
+        auto e = reg.CreateEntity();
+        reg.Set<Health>(e, (i >= 512 && i < 768 && i % 4 == 0) ? -1.0f : 50.0f);
+        entities.push_back(e);
+    }
+
+    const auto anyDead = [](const ent::KeyRange<float>& r) { return r.min <= 0.0f; };
+
+    SECTION("Only matching chunks are visited")
+    {
+        size_t visited = 0;
+        size_t dead = 0;
+        reg.EachWhere<Health, Position>(anyDead, [&](Health& h, Position&) {
+            ++visited;
+            if (h.value <= 0.0f) ++dead;
+        });
+        REQUIRE(visited == 256);
+        REQUIRE(dead == 64);
+    }
+
+    SECTION("Set invalidates the affected chunk summary")
+    {
+        reg.Set<Health>(entities[3], -5.0f);
+        size_t visited = 0;
+        size_t dead = 0;
+        reg.EachWhere<Health>(anyDead, [&](const Health& h) {
+            ++visited;
+            if (h.value <= 0.0f) ++dead;
+        });
+        REQUIRE(visited == 512);
+        REQUIRE(dead == 65);
+    }
+
+    SECTION("Writes through Get are tracked")
+    {
+        reg.Get<Health>(entities[1000]).value = 0.0f;
+        size_t dead = 0;
+        reg.EachWhere<Health>(anyDead, [&](const Health& h) { if (h.value <= 0.0f) ++dead; });
+        REQUIRE(dead == 65);
+    }
+
+    SECTION("Destroy keeps summaries conservative")
+    {
+        // Swap-remove moves a live entity from the last chunk into chunk 2's slot.
+        reg.DestroyEntity(entities[512]);
+        size_t dead = 0;
+        reg.EachWhere<Health>(anyDead, [&](const Health& h) { if (h.value <= 0.0f) ++dead; });
+        REQUIRE(dead == 63);
+    }
+
+    SECTION("Const overload visits stale chunks until refreshed")
+    {
+        const Reg& creg = reg;
+        size_t visited = 0;
+        creg.EachWhere<Health>(anyDead, [&](const Health&) { ++visited; });
+        REQUIRE(visited == 1024);
+
+        reg.RefreshSummaries<Health>();
+        visited = 0;
+        creg.EachWhere<Health>(anyDead, [&](const Health&) { ++visited; });
+        REQUIRE(visited == 256);
+    }
+}
+
+// =============================================================================
+// Column Reductions
+// =============================================================================
+
+TEST_CASE("Registry: column reductions match a per-entity fold", "[Registry][Reduce]")
+{
+    using Reg = ent::Registry<size_t{64}, Position, Velocity>;
+    Reg reg;
+
+    std::vector<ent::Entity> entities;
+    for (int i = 0; i < 1000; ++i) {
+        auto e = reg.CreateEntity();
+        reg.Set<Position>(e, static_cast<float>(i), static_cast<float>(-i), 1.0f);
+        entities.push_back(e);
+    }
+    // Leave surplus allocated chunks behind: spans must cover live slots only.
+    for (int i = 300; i < 1000; ++i) {
+        reg.DestroyEntity(entities[i]);
+    }
+
+    double expectedSum = 0.0;
+    float expectedMin = std::numeric_limits<float>::max();
+    float expectedMax = std::numeric_limits<float>::lowest();
+    size_t expectedCount = 0;
+    reg.Each<Position>([&](const Position& p) {
+        expectedSum += p.x;
+        expectedMin = std::min(expectedMin, p.y);
+        expectedMax = std::max(expectedMax, p.x);
+        if (p.x >= 100.0f) ++expectedCount;
+    });
+
+    const auto spans = reg.Components<Position>();
+    REQUIRE(std::accumulate(spans.begin(), spans.end(), size_t{0},
+        [](size_t sum, const auto& span) { return sum + span.size(); }) == 300);
+
+    REQUIRE(reg.TransformReduce<Position>(0.0, std::plus<>{}, [](const Position& p) { return double(p.x); }) == expectedSum);
+    REQUIRE(reg.Sum<Position>([](const Position& p) { return p.z; }) == 300.0f);
+    REQUIRE(reg.Min<Position>([](const Position& p) { return p.y; }) == expectedMin);
+    REQUIRE(reg.Max<Position>([](const Position& p) { return p.x; }) == expectedMax);
+    REQUIRE(reg.Count<Position>([](const Position& p) { return p.x >= 100.0f; }) == expectedCount);
+
+    for (size_t threads : { size_t{1}, size_t{3}, size_t{16} }) {
+        REQUIRE(reg.ParallelTransformReduce<Position>(0.0, std::plus<>{},
+            [](const Position& p) { return double(p.x); }, threads) == expectedSum);
+    }
+
+    // Result types need not be default-constructible.
+    struct Total {
+        explicit Total(double v) : value(v) {}
+        double value;
+    };
+    const auto add = [](const Total& a, const Total& b) { return Total(a.value + b.value); };
+    const auto toTotal = [](const Position& p) { return Total(p.x); };
+    REQUIRE(reg.TransformReduce<Position>(Total(0.0), add, toTotal).value == expectedSum);
+    REQUIRE(reg.ParallelTransformReduce<Position>(Total(0.0), add, toTotal, 3).value == expectedSum);
+
+    Reg empty;
+    REQUIRE(empty.Sum<Position>([](const Position& p) { return p.x; }) == 0.0f);
+    REQUIRE(empty.ParallelTransformReduce<Position>(7, std::plus<>{}, [](const Position&) { return 1; }) == 7);
+}
+
+// =============================================================================
+// Field-Split Components (UserConfig<T>::SplitFields)
+// =============================================================================
+
+TEST_CASE("Registry: SplitFields stores one column per member", "[Registry][SplitFields]")
+{
+    static_assert(ent::aggregate_arity<Transform>() == 7);
+
+    auto exercise = [](auto& reg) {
+        std::vector<ent::Entity> entities;
+        for (int i = 0; i < 300; ++i) {
+            auto e = reg.CreateEntity();
+            const float f = static_cast<float>(i);
+            reg.template Set<Transform>(e, f, f + 1, f + 2, 0.0f, 0.0f, 0.0f, 1.0f);
+            entities.push_back(e);
+        }
+
+        // Get returns a proxy: conversion, get<I>() and structured bindings
+        const Transform t = reg.template Get<Transform>(entities[10]);
+        REQUIRE(t.x == 10.0f);
+        REQUIRE(t.z == 12.0f);
+        REQUIRE(t.qw == 1.0f);
+
+        auto ref = reg.template Get<Transform>(entities[20]);
+        auto& [x, y, z, qx, qy, qz, qw] = ref;
+        x = -1.0f;
+        (void)y; (void)z; (void)qx; (void)qy; (void)qz; (void)qw;
+        REQUIRE(reg.template Get<Transform>(entities[20]).template get<0>() == -1.0f);
+
+        // Whole-value assignment through the proxy
+        reg.template Get<Transform>(entities[30]) = Transform{ 5, 6, 7, 0, 0, 0, 1 };
+        REQUIRE(static_cast<Transform>(reg.template Get<Transform>(entities[30])).y == 6.0f);
+
+        // Each passes proxies; multi-component Get keeps them by value
+        size_t visited = 0;
+        reg.template Each<Transform, Position>([&](auto tr, Position&) {
+            tr.template get<1>() += 1.0f;
+            ++visited;
+        });
+        REQUIRE(visited == 300);
+        auto [tr, pos] = reg.template Get<Transform, Position>(entities[10]);
+        REQUIRE(tr.template get<1>() == 12.0f);
+        (void)pos;
+
+        // Swap-on-destroy moves every member of the last element
+        reg.DestroyEntity(entities[0]);
+        const Transform last = reg.template Get<Transform>(entities[299]);
+        REQUIRE(last.x == 299.0f);
+        REQUIRE(last.y == 301.0f);
+
+        // Member columns are exposed as plain spans
+        float sumX = 0.0f;
+        size_t count = 0;
+        for (auto span : reg.template FieldComponents<Transform, 0>()) {
+            for (float v : span) sumX += v;
+            count += span.size();
+        }
+        REQUIRE(count == 299);
+        REQUIRE(sumX > 0.0f);
+    };
+
+    SECTION("Chunked storage")
+    {
+        ent::Registry<size_t{64}, Transform, Position> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous storage")
+    {
+        ent::Registry<size_t{0}, Transform, Position> reg;
+        exercise(reg);
+    }
+}
+
+TEST_CASE("Registry: SplitFields swap-remove moves each member", "[Registry][SplitFields]")
+{
+    ent::Registry<size_t{64}, Owned> reg;
+    std::vector<ent::Entity> entities;
+    for (int i = 0; i < 100; ++i) {
+        auto e = reg.CreateEntity();
+        reg.Set<Owned>(e, std::make_unique<int>(i), std::string(40, static_cast<char>('a' + i % 26)));
+        entities.push_back(e);
+    }
+
+    const int* handle = reg.Get<Owned>(entities[99]).get<0>().get();
+    const char* chars = reg.Get<Owned>(entities[99]).get<1>().data();
+    reg.DestroyEntity(entities[5]);
+
+    // The last element took the freed slot; its heap storage moved along.
+    auto moved = reg.Get<Owned>(entities[99]);
+    REQUIRE(moved.get<0>().get() == handle);
+    REQUIRE(*moved.get<0>() == 99);
+    REQUIRE(moved.get<1>().data() == chars);
+
+    for (int i = 0; i < 100; i += 3)
+        reg.DestroyEntity(entities[i]);
+    for (int i = 0; i < 100; ++i) {
+        if (reg.IsValidEntity(entities[i])) {
+            REQUIRE(*reg.Get<Owned>(entities[i]).get<0>() == i);
+            REQUIRE(reg.Get<Owned>(entities[i]).get<1>() == std::string(40, static_cast<char>('a' + i % 26)));
+        }
+    }
+}
+
+TEST_CASE("Registry: Direct layout indexes columns by entity index", "[Registry][Direct]")
+{
+    auto exercise = [](auto& reg) {
+        using Reg = std::decay_t<decltype(reg)>;
+        STATIC_REQUIRE(Reg::IsDirect);
+
+        std::vector<ent::Entity> entities;
+        for (size_t i = 0; i < 300; ++i) {
+            auto e = reg.CreateEntity();
+            reg.template Set<Position>(e, float(i), 0.0f, 0.0f);
+            reg.template Set<Health>(e, float(i));
+            entities.push_back(e);
+        }
+        const Position* cached = reg.template TryGet<Position>(entities[299]);
+
+        // Destroy every third entity, and all of the second 64-entity word
+        std::set<size_t> dead;
+        for (size_t i = 0; i < 300; ++i) {
+            if (i % 3 == 0 || (i >= 64 && i < 128)) {
+                reg.DestroyEntity(entities[i]);
+                dead.insert(i);
+            }
+        }
+        REQUIRE(reg.Size() == 300 - dead.size());
+
+        // Survivors keep their slot: no element moved
+        REQUIRE(reg.template TryGet<Position>(entities[299]) == cached);
+        REQUIRE(reg.template Get<Position>(entities[299]).x == 299.0f);
+
+        float sum = 0.0f;
+        size_t count = 0;
+        reg.template Each<Position, Health>([&](const Position& p, const Health& h) {
+            REQUIRE(p.x == h.value);
+            REQUIRE(dead.count(size_t(p.x)) == 0);
+            sum += p.x;
+            ++count;
+        });
+        REQUIRE(count == reg.Size());
+
+        float expected = 0.0f;
+        for (size_t i = 0; i < 300; ++i)
+            if (!dead.count(i)) expected += float(i);
+        REQUIRE(sum == expected);
+        REQUIRE(reg.template Sum<Position>([](const Position& p) { return p.x; }) == expected);
+        REQUIRE(reg.template Count<Position>([](const Position&) { return true; }) == reg.Size());
+        REQUIRE(reg.template Min<Health>([](const Health& h) { return h.value; }) == 1.0f);
+        REQUIRE(reg.template ParallelTransformReduce<Position>(0.0f, std::plus<>{},
+            [](const Position& p) { return p.x; }, 3) == expected);
+
+        size_t low = 0;
+        reg.template EachWhere<Health>([](const ent::KeyRange<float>& r) { return r.min < 10.0f; },
+            [&](const Health& h) { if (h.value < 10.0f) ++low; });
+        REQUIRE(low == 6); // 1 2 4 5 7 8
+
+        // Holes are reset, and recycled indices start from a default component
+        REQUIRE((reg.AliveMask()[0] & 1u) == 0);
+        const auto reborn = reg.CreateEntity();
+        REQUIRE(ent::EntityToIndex(reborn) == ent::EntityToIndex(entities[297]));
+        REQUIRE(reg.template Get<Position>(reborn).x == 0.0f);
+        REQUIRE(reg.template Get<Health>(reborn).value == 100.0f);
+
+        reg.Clear();
+        count = 0;
+        reg.template Each<Position>([&](const Position&) { ++count; });
+        REQUIRE(count == 0);
+    };
+
+    SECTION("Chunked storage")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 64, .layout = ent::ColumnLayout::Direct }, Position, Health> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous storage")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 0, .layout = ent::ColumnLayout::Direct }, Position, Health> reg;
+        exercise(reg);
+    }
+}
+
+TEST_CASE("Registry: StableAddresses components keep their address", "[Registry][StableAddresses]")
+{
+    using Reg = ent::Registry<size_t{64}, Position, Body>;
+    Reg reg;
+
+    std::vector<ent::Entity> entities;
+    std::vector<const Body*> cached;
+    for (size_t i = 0; i < 200; ++i) {
+        auto e = reg.CreateEntity();
+        reg.Set<Position>(e, float(i), 0.0f, 0.0f);
+        reg.Set<Body>(e, float(i), std::vector<int>{ int(i) });
+        entities.push_back(e);
+        cached.push_back(reg.TryGet<Body>(e));
+    }
+
+    std::set<size_t> dead;
+    for (size_t i = 0; i < 200; i += 3) {
+        reg.DestroyEntity(entities[i]);
+        dead.insert(i);
+    }
+
+    // Body never moves, while Position (packed) was swapped around
+    for (size_t i = 0; i < 200; ++i) {
+        if (dead.count(i)) continue;
+        REQUIRE(reg.TryGet<Body>(entities[i]) == cached[i]);
+        REQUIRE(cached[i]->mass == float(i));
+        REQUIRE(reg.Get<Position>(entities[i]).x == float(i));
+    }
+
+    SECTION("Iteration skips tombstones, whichever column leads")
+    {
+        size_t count = 0;
+        reg.Each<Body, Position>([&](const Body& b, const Position& p) {
+            REQUIRE(b.mass == p.x);
+            REQUIRE(b.contacts == std::vector<int>{ int(p.x) });
+            ++count;
+        });
+        REQUIRE(count == reg.Size());
+
+        count = 0;
+        std::as_const(reg).Each<Position, Body>([&](const Position& p, const Body& b) {
+            REQUIRE(b.mass == p.x);
+            ++count;
+        });
+        REQUIRE(count == reg.Size());
+
+        float expected = 0.0f;
+        for (size_t i = 0; i < 200; ++i)
+            if (!dead.count(i)) expected += float(i);
+        REQUIRE(reg.Sum<Body>([](const Body& b) { return b.mass; }) == expected);
+    }
+
+    SECTION("New entities reuse tombstones with a fresh component")
+    {
+        const auto e = reg.CreateEntity();
+        REQUIRE(reg.TryGet<Body>(e) == cached[198]);
+        REQUIRE(reg.Get<Body>(e).mass == 1.0f);
+        REQUIRE(reg.Get<Body>(e).contacts.empty());
+    }
+
+    SECTION("ShrinkToFit drops trailing tombstones only")
+    {
+        for (size_t i = 150; i < 200; ++i)
+            if (!dead.count(i)) reg.DestroyEntity(entities[i]);
+        reg.ShrinkToFit();
+
+        size_t slots = 0;
+        for (auto span : reg.Components<Body>()) slots += span.size();
+        REQUIRE(slots == 150);
+        REQUIRE(reg.TryGet<Body>(entities[149]) == cached[149]);
+
+        // Remaining tombstones are still reused before the column grows
+        const auto e = reg.CreateEntity();
+        REQUIRE(reg.TryGet<Body>(e) == cached[147]);
+    }
+}
+
+TEST_CASE("Registry: free-list policies control index reuse order", "[Registry][FreeList]")
+{
+    auto exercise = [](auto& reg, auto expectNext) {
+        std::vector<ent::Entity> entities;
+        for (int i = 0; i < 10; ++i)
+            entities.push_back(reg.CreateEntity());
+
+        // Free 7, 2, 5 (in that order) and check which index comes back first
+        std::vector<uint32_t> freed;
+        for (uint32_t i : { 7u, 2u, 5u }) {
+            reg.DestroyEntity(entities[i]);
+            freed.push_back(i);
+        }
+        std::vector<uint32_t> reused;
+        for (int i = 0; i < 3; ++i) {
+            const auto e = reg.CreateEntity();
+            REQUIRE(ent::EntityToVersion(e) == 1);
+            reused.push_back(ent::EntityToIndex(e));
+        }
+        REQUIRE(reused == expectNext(freed));
+        for (uint32_t i : freed)
+            REQUIRE_FALSE(reg.IsValidEntity(entities[i]));
+
+        // Exhausted free list falls back to fresh indices
+        REQUIRE(ent::EntityToIndex(reg.CreateEntity()) == 10);
+
+        // Randomized churn against a reference model of the policy
+        std::mt19937 rng(7);
+        std::vector<ent::Entity> live;
+        reg.Clear();
+        for (int i = 0; i < 300; ++i) live.push_back(reg.CreateEntity());
+        std::vector<uint32_t> order; // free indices, in release order
+        for (int step = 0; step < 2000; ++step) {
+            if (!live.empty() && (rng() % 2 == 0 || order.size() < 2)) {
+                const size_t k = rng() % live.size();
+                order.push_back(ent::EntityToIndex(live[k]));
+                reg.DestroyEntity(live[k]);
+                live[k] = live.back();
+                live.pop_back();
+            } else {
+                const uint32_t expected = expectNext(order).front();
+                const auto e = reg.CreateEntity();
+                REQUIRE(ent::EntityToIndex(e) == expected);
+                order.erase(std::find(order.begin(), order.end(), expected));
+                live.push_back(e);
+            }
+            REQUIRE(reg.Size() == live.size());
+        }
+    };
+
+    SECTION("Lifo")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 64, .freeList = ent::FreeListPolicy::Lifo }, Position> reg;
+        exercise(reg, [](std::vector<uint32_t> v) { std::reverse(v.begin(), v.end()); return v; });
+    }
+
+    SECTION("Fifo")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 64, .freeList = ent::FreeListPolicy::Fifo }, Position> reg;
+        exercise(reg, [](std::vector<uint32_t> v) { return v; });
+    }
+
+    SECTION("LowestIndex")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 0, .freeList = ent::FreeListPolicy::LowestIndex }, Position> reg;
+        exercise(reg, [](std::vector<uint32_t> v) { std::sort(v.begin(), v.end()); return v; });
+    }
+}
+
+TEST_CASE("FreeIndexSet: finds the lowest free index across summary words", "[FreeList]")
+{
+    ent::FreeIndexSet set;
+    set.Reserve(70000);
+    REQUIRE(set.FindFrom(0) == ent::EntityTraits::INVALID_INDEX);
+
+    for (size_t i : { size_t{5}, size_t{63}, size_t{64}, size_t{4100}, size_t{70000} })
+        set.Insert(i);
+    REQUIRE(set.FindFrom(0) == 5);
+    REQUIRE(set.FindFrom(6) == 63);
+    REQUIRE(set.FindFrom(64) == 64);
+    REQUIRE(set.FindFrom(65) == 4100);
+    REQUIRE(set.FindFrom(4101) == 70000);
+    REQUIRE(set.FindFrom(70001) == ent::EntityTraits::INVALID_INDEX);
+
+    set.Erase(4100);
+    REQUIRE(set.FindFrom(65) == 70000);
+    set.Erase(64);
+    set.Erase(63);
+    REQUIRE(set.FindFrom(6) == 70000);
+}
+
+TEST_CASE("Registry: contiguous columns reserve room for maxEntities", "[Registry][Contiguous]")
+{
+    using Small = ent::Registry<ent::RegistryOptions{ .chunkSize = 0, .maxEntities = 1000 }, Position, Health>;
+    STATIC_REQUIRE(Small::MaxEntities == 1000);
+    STATIC_REQUIRE(Small::ContiguousArray<Position>::max_size() >= 1000);
+    STATIC_REQUIRE(Small::ContiguousArray<Position>::max_size() < 1000 + 64 * 1024 / sizeof(Position));
+
+    Small reg;
+    std::vector<ent::Entity> entities(1000);
+    reg.CreateEntities(entities);
+    REQUIRE_THROWS_AS(reg.CreateEntity(), std::runtime_error);
+    reg.DestroyEntity(entities[7]);
+    REQUIRE(reg.IsValidEntity(reg.CreateEntity()));
+
+    // The default covers every entity index without exhausting the address
+    // space when many registries coexist.
+    using Wide = ent::Registry<size_t{0}, Position, Velocity, Health, Tag>;
+    std::vector<std::unique_ptr<Wide>> many;
+    for (int i = 0; i < 1000; ++i) {
+        many.push_back(std::make_unique<Wide>());
+        (void)many.back()->CreateEntity();
+    }
+    REQUIRE(many.back()->Size() == 1);
+}
+
+TEST_CASE("Registry: ShrinkToFit trims the free index tail", "[Registry][ShrinkToFit][Footprint]")
+{
+    auto exercise = [](auto& reg) {
+        std::vector<ent::Entity> entities(4000);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i)
+            reg.template Set<Position>(entities[i], float(i), 0.0f, 0.0f);
+
+        // Spike falls back to indices [0, 500), with a few interior holes
+        std::vector<ent::Entity> doomed(entities.begin() + 500, entities.end());
+        for (size_t i : { 10, 200, 498 })
+            doomed.push_back(entities[i]);
+        std::shuffle(doomed.begin(), doomed.end(), std::mt19937(3));
+        reg.DestroyEntities(doomed);
+
+        const ent::Footprint before = reg.MemoryFootprint();
+        reg.ShrinkToFit();
+        const ent::Footprint after = reg.MemoryFootprint();
+
+        REQUIRE(reg.entities.size() == 500);
+        REQUIRE(reg.Size() == 497);
+        REQUIRE(after.allocatedBytes < before.allocatedBytes / 4);
+        REQUIRE(after.usedBytes <= before.usedBytes);
+        REQUIRE(after.ReclaimableBytes() < before.ReclaimableBytes());
+
+        for (size_t i = 0; i < 500; ++i) {
+            const bool live = i != 10 && i != 200 && i != 498;
+            REQUIRE(reg.IsValidEntity(entities[i]) == live);
+            if (live) REQUIRE(reg.template Get<Position>(entities[i]).x == float(i));
+        }
+
+        // The three interior holes are reused first, then the trimmed range
+        // regrows with versions no stale handle carries.
+        std::set<uint32_t> reused;
+        for (int i = 0; i < 3; ++i)
+            reused.insert(ent::EntityToIndex(reg.CreateEntity()));
+        REQUIRE(reused == std::set<uint32_t>{ 10, 200, 498 });
+        for (size_t i = 500; i < 1000; ++i) {
+            const auto e = reg.CreateEntity();
+            REQUIRE(ent::EntityToIndex(e) == i);
+            REQUIRE(e != entities[i]);
+            REQUIRE_FALSE(reg.IsValidEntity(entities[i]));
+            REQUIRE(reg.template Get<Position>(e).x == 0.0f);
+        }
+        size_t count = 0;
+        reg.template Each<Position>([&](const Position&) { ++count; });
+        REQUIRE(count == reg.Size());
+    };
+
+    SECTION("Packed, Lifo")
+    {
+        ent::Registry<size_t{64}, Position, Health> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous, Fifo")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 0, .freeList = ent::FreeListPolicy::Fifo }, Position, Health> reg;
+        exercise(reg);
+    }
+
+    SECTION("Direct, LowestIndex")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 64, .layout = ent::ColumnLayout::Direct,
+            .freeList = ent::FreeListPolicy::LowestIndex }, Position, Health> reg;
+        exercise(reg);
+    }
+
+    SECTION("StableAddresses column")
+    {
+        ent::Registry<size_t{64}, Position, Body> reg;
+        exercise(reg);
+    }
+}
+
+TEST_CASE("Registry: MemoryStats reports per-column occupancy", "[Registry][Footprint]")
+{
+    ent::Registry<size_t{64}, Position, Transform, Body> reg;
+    std::vector<ent::Entity> entities(1000);
+    reg.CreateEntities(entities);
+
+    auto stats = reg.MemoryStats();
+    REQUIRE(stats.liveEntities == 1000);
+    REQUIRE(stats.freeListLength == 0);
+    REQUIRE(stats.columns[0].chunkCount == 16);
+    REQUIRE(stats.columns[0].liveChunkCount == 16);
+    REQUIRE(stats.columns[1].chunkCount == 7 * 16);  // one ChunkedArray per field
+    REQUIRE(stats.columns[0].data.usedBytes == 1000 * sizeof(Position));
+    REQUIRE(stats.columns[1].data.usedBytes == 1000 * sizeof(Transform));
+
+    std::vector<ent::Entity> doomed;
+    for (size_t i = 0; i < entities.size(); ++i)
+        if (i % 10 < 3) doomed.push_back(entities[i]);
+    reg.DestroyEntities(doomed);
+
+    stats = reg.MemoryStats();
+    REQUIRE(stats.liveEntities == 700);
+    REQUIRE(stats.freeListLength == 300);
+
+    // Packed columns shrink to the front, keeping their chunks allocated
+    const ent::ColumnMemoryStats& position = stats.columns[0];
+    REQUIRE(position.chunkCount == 16);
+    REQUIRE(position.liveChunkCount == 11);
+    REQUIRE(position.data.usedBytes == 700 * sizeof(Position));
+    REQUIRE(position.reverse.usedBytes == 700 * sizeof(ent::Entity));
+    REQUIRE(position.sparse.allocatedBytes >= 1000 * sizeof(uint32_t));
+    REQUIRE(position.freeSlots == 0);
+
+    // The stable column keeps tombstones in place
+    const ent::ColumnMemoryStats& body = stats.columns[2];
+    REQUIRE(body.liveChunkCount == 16);
+    REQUIRE(body.freeSlots == 300);
+    REQUIRE(body.tombstones.allocatedBytes > 0);
+    REQUIRE(body.data.usedBytes == 700 * sizeof(Body));
+
+    const ent::Footprint total = stats.Total();
+    REQUIRE(total.allocatedBytes == reg.MemoryFootprint().allocatedBytes);
+    REQUIRE(total.usedBytes < total.allocatedBytes);
+
+    reg.ShrinkToFit();
+    const auto trimmed = reg.MemoryStats();
+    REQUIRE(trimmed.columns[0].chunkCount == 11);
+    REQUIRE(trimmed.Total().allocatedBytes < total.allocatedBytes);
+}
+
+TEST_CASE("Registry: ChunkBytes sizes chunks per component", "[Registry][ChunkBytes]")
+{
+    SECTION("Packed columns zip across chunk sizes")
+    {
+        using Reg = ent::Registry<size_t{1024}, Position, Tag, Inventory>;
+        Reg reg;
+        STATIC_REQUIRE(ent::ComponentStorage<Reg, Position>::DataChunkSize == 1024);
+        STATIC_REQUIRE(ent::ComponentStorage<Reg, Tag>::DataChunkSize == 64);
+        STATIC_REQUIRE(ent::ComponentStorage<Reg, Inventory>::DataChunkSize == 8);
+
+        std::vector<ent::Entity> entities(1000);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            reg.Set<Tag>(entities[i], uint32_t(i));
+            reg.Set<Inventory>(entities[i], uint32_t(i));
+        }
+        reg.DestroyEntity(entities[3]);  // swap-and-pop across chunks
+
+        REQUIRE(reg.Components<Position>().size() == 1);
+        REQUIRE(reg.Components<Tag>().size() == 16);
+        REQUIRE(reg.Components<Inventory>().size() == 125);
+
+        size_t visited = 0;
+        reg.Each<Tag, Inventory>([&](const Tag& t, const Inventory& inv) {
+            REQUIRE(t.id == inv.id);
+            ++visited;
+        });
+        REQUIRE(visited == 999);
+
+        size_t runs = 0;
+        visited = 0;
+        reg.EachSpan<Position, Tag, Inventory>([&](std::span<Position> p, std::span<Tag> t, std::span<Inventory> inv) {
+            REQUIRE(p.size() == t.size());
+            REQUIRE(t.size() == inv.size());
+            REQUIRE(inv.size() <= 8);
+            for (size_t i = 0; i < t.size(); ++i) {
+                REQUIRE(t[i].id == inv[i].id);
+                p[i].x = float(t[i].id);
+            }
+            visited += t.size();
+            ++runs;
+        });
+        REQUIRE(visited == 999);
+        REQUIRE(runs == 125);
+        REQUIRE(reg.Get<Position>(entities[500]).x == 500.0f);
+        REQUIRE(reg.Get<Position>(entities[999]).x == 999.0f);
+
+        const auto stats = reg.MemoryStats();
+        REQUIRE(stats.columns[1].chunkCount == 16);
+        REQUIRE(stats.columns[2].chunkCount == 125);
+    }
+
+    SECTION("EachWhere invalidates every written chunk of a finer column")
+    {
+        using Reg = ent::Registry<size_t{1024}, Health, Fuel>;
+        Reg reg;
+        STATIC_REQUIRE(ent::ComponentStorage<Reg, Fuel>::DataChunkSize == 64);
+
+        std::vector<ent::Entity> entities(1024);
+        reg.CreateEntities(entities);
+        reg.RefreshSummaries<Fuel>();
+
+        // One lead chunk of Health spans 16 chunks of Fuel.
+        reg.EachWhere<Health, Fuel>([](const auto&) { return true; }, [](Health&, Fuel& f) { f.value = 100.0f; });
+
+        size_t full = 0;
+        reg.EachWhere<Fuel>([](const auto& r) { return r.max >= 100.0f; }, [&](const Fuel& f) {
+            if (f.value >= 100.0f) ++full;
+        });
+        REQUIRE(full == 1024);
+    }
+
+    SECTION("Columns with holes keep at least 64 slots per chunk")
+    {
+        using Reg = ent::Registry<ent::RegistryOptions{ .chunkSize = 256, .layout = ent::ColumnLayout::Direct }, Tag, Inventory>;
+        Reg reg;
+        STATIC_REQUIRE(ent::ComponentStorage<Reg, Inventory>::DataChunkSize == 64);
+
+        std::vector<ent::Entity> entities(200);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i)
+            reg.Set<Inventory>(entities[i], uint32_t(i));
+        for (size_t i = 0; i < entities.size(); i += 3)
+            reg.DestroyEntity(entities[i]);
+
+        uint64_t sum = 0;
+        reg.Each<Inventory>([&](const Inventory& inv) { sum += inv.id; });
+        REQUIRE(sum == reg.Sum<Inventory>([](const Inventory& inv) { return uint64_t{ inv.id }; }));
+        REQUIRE(reg.Components<Inventory>().size() == 4);
+    }
+
+    SECTION("Contiguous registries ignore ChunkBytes")
+    {
+        using Reg = ent::Registry<size_t{0}, Tag, Inventory>;
+        Reg reg;
+        STATIC_REQUIRE(ent::ComponentStorage<Reg, Inventory>::DataChunkSize == 0);
+        for (int i = 0; i < 100; ++i)
+            reg.Set<Tag>(reg.CreateEntity(), uint32_t(i));
+        size_t visited = 0;
+        reg.EachSpan<Tag, Inventory>([&](std::span<const Tag> t, std::span<const Inventory>) { visited += t.size(); });
+        REQUIRE(visited == 100);
+    }
+}
+
+TEST_CASE("PackedColumn: word-at-a-time match helpers", "[PackedBits]")
+{
+    ent::PackedColumn<Team, 2, ent::VirtualArray> column;
+    std::vector<Team> reference;
+    for (size_t i = 0; i < 1000; ++i) {
+        column.emplace_back();
+        const Team t = (i % 7 == 0) ? Team::Blue : Team(i % 2);
+        column[i] = t;
+        reference.push_back(t);
+    }
+    REQUIRE(column.Words().size() == (1000 + 31) / 32);
+
+    for (Team t : { Team::None, Team::Red, Team::Blue, Team::Green })
+        REQUIRE(column.CountEqual(t) == size_t(std::count(reference.begin(), reference.end(), t)));
+
+    std::vector<size_t> blues;
+    column.ForEachEqual(Team::Blue, 100, 900, [&](size_t i) { blues.push_back(i); });
+    std::vector<size_t> expected;
+    for (size_t i = 100; i < 900; ++i)
+        if (reference[i] == Team::Blue) expected.push_back(i);
+    REQUIRE(blues == expected);
+
+    REQUIRE(column.FindNext(Team::Blue, 1) == 7);
+    REQUIRE(column.FindNext(Team::Blue, 995) == 1000);
+    REQUIRE(column.FindNext(Team::Green, 0) == column.size());
+
+    // Popped lanes are cleared, so regrown elements read as T{}
+    for (int i = 0; i < 10; ++i)
+        column.pop_back();
+    column.emplace_back();
+    REQUIRE(column[990] == Team::None);
+    REQUIRE(column.CountEqual(Team::None) == size_t(std::count(reference.begin(), reference.begin() + 990, Team::None)) + 1);
+}
+
+TEST_CASE("Registry: PackedBits components", "[Registry][PackedBits]")
+{
+    auto exercise = [](auto& reg) {
+        std::vector<ent::Entity> entities(1000);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            reg.template Set<Position>(entities[i], float(i), 0.0f, 0.0f);
+            reg.template Set<Visibility>(entities[i], i % 3 == 0 ? Visibility::Shown : Visibility::Hidden);
+            reg.template Get<Team>(entities[i]) = Team(i % 4);
+        }
+        for (size_t i = 0; i < entities.size(); i += 5)
+            reg.DestroyEntity(entities[i]);
+
+        size_t shown = 0, blue = 0, hidden = 0;
+        reg.template Each<Position, Visibility, Team>([&](const Position& p, Visibility v, Team t) {
+            const size_t i = size_t(p.x);
+            REQUIRE(v == (i % 3 == 0 ? Visibility::Shown : Visibility::Hidden));
+            REQUIRE(t == Team(i % 4));
+            shown += v == Visibility::Shown;
+            hidden += v == Visibility::Hidden;
+            blue += t == Team::Blue;
+        });
+        REQUIRE(reg.CountEqual(Visibility::Shown) == shown);
+        REQUIRE(reg.CountEqual(Visibility::Hidden) == hidden);
+        REQUIRE(reg.CountEqual(Team::Blue) == blue);
+
+        size_t visited = 0;
+        reg.template EachEqual<Visibility, Position, Team>(Visibility::Shown, [&](auto v, Position& p, Team t) {
+            REQUIRE(Visibility(v) == Visibility::Shown);
+            REQUIRE(size_t(p.x) % 3 == 0);
+            REQUIRE(t == Team(size_t(p.x) % 4));
+            v = Visibility::Hidden;
+            ++visited;
+        });
+        REQUIRE(visited == shown);
+        REQUIRE(reg.CountEqual(Visibility::Shown) == 0);
+        REQUIRE(reg.CountEqual(Visibility::Hidden) == reg.Size());
+
+        REQUIRE(reg.template Get<Team>(entities[7]) == Team::Green);
+        const auto& creg = reg;
+        REQUIRE(creg.template Get<Team>(entities[6]) == Team::Blue);
+
+        const auto stats = reg.MemoryStats();
+        REQUIRE(stats.columns[1].data.usedBytes <= (1000 + 63) / 64 * sizeof(uint64_t));
+        REQUIRE(stats.columns[2].data.usedBytes <= (1000 + 31) / 32 * sizeof(uint64_t));
+    };
+
+    SECTION("Packed layout")
+    {
+        ent::Registry<size_t{64}, Position, Visibility, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Direct layout")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 64, .layout = ent::ColumnLayout::Direct }, Position, Visibility, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous")
+    {
+        ent::Registry<size_t{0}, Position, Visibility, Team> reg;
+        exercise(reg);
+    }
+}
+
+TEST_CASE("Registry: Clone reproduces entities, free list and columns", "[Registry][Clone]")
+{
+    auto exercise = [](auto& reg) {
+        std::vector<ent::Entity> entities(2000);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const float f = static_cast<float>(i);
+            reg.template Set<Position>(entities[i], f, f + 1, f + 2);
+            reg.template Set<Health>(entities[i], f);
+            reg.template Set<Transform>(entities[i], f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+            reg.template Set<Team>(entities[i], Team(i % 4));
+        }
+        for (size_t i = 0; i < entities.size(); i += 3)
+            reg.DestroyEntity(entities[i]);
+
+        auto check = [&](auto& fork) {
+            REQUIRE(fork.Size() == reg.Size());
+            for (size_t i = 0; i < entities.size(); ++i) {
+                const ent::Entity e = entities[i];
+                REQUIRE(fork.IsValidEntity(e) == reg.IsValidEntity(e));
+                if (!reg.IsValidEntity(e)) continue;
+                REQUIRE(fork.template Get<Position>(e).y == static_cast<float>(i + 1));
+                REQUIRE(fork.template Get<Health>(e).value == static_cast<float>(i));
+                REQUIRE(static_cast<Transform>(fork.template Get<Transform>(e)).x == static_cast<float>(i));
+                REQUIRE(fork.template Get<Team>(e) == Team(i % 4));
+            }
+
+            // Dense order is reproduced, so iteration visits the same sequence
+            std::vector<float> a, b;
+            reg.template Each<Position>([&](const Position& p) { a.push_back(p.x); });
+            fork.template Each<Position>([&](const Position& p) { b.push_back(p.x); });
+            REQUIRE(a == b);
+            REQUIRE(fork.CountEqual(Team::Blue) == reg.CountEqual(Team::Blue));
+        };
+
+        SECTION("Clone")
+        {
+            auto fork = reg.Clone();
+            check(fork);
+
+            // The copy is independent
+            fork.template Get<Position>(entities[1]).x = -1.0f;
+            fork.DestroyEntity(entities[2]);
+            REQUIRE(reg.template Get<Position>(entities[1]).x == 1.0f);
+            REQUIRE(reg.IsValidEntity(entities[2]));
+
+            // ...and continues exactly like the original
+            const ent::Entity next = reg.CreateEntity();
+            auto fork2 = reg.Clone();
+            reg.DestroyEntity(next);
+            fork2.DestroyEntity(next);
+            REQUIRE(reg.CreateEntity() == fork2.CreateEntity());
+            REQUIRE(reg.CreateEntity() == fork2.CreateEntity());
+        }
+
+        SECTION("ParallelClone")
+        {
+            auto fork = reg.ParallelClone(3);
+            check(fork);
+        }
+    };
+
+    SECTION("Packed layout")
+    {
+        ent::Registry<size_t{64}, Position, Health, Transform, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Direct layout, lowest-index free list")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 64, .layout = ent::ColumnLayout::Direct,
+            .freeList = ent::FreeListPolicy::LowestIndex }, Position, Health, Transform, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous, FIFO free list")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 0, .freeList = ent::FreeListPolicy::Fifo },
+            Position, Health, Transform, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Non-trivial StableAddresses column")
+    {
+        ent::Registry<size_t{64}, Position, Body> reg;
+        std::vector<ent::Entity> entities(100);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i)
+            reg.Get<Body>(entities[i]).contacts.assign(i % 5, static_cast<int>(i));
+        reg.DestroyEntity(entities[10]);
+
+        auto fork = reg.Clone();
+        REQUIRE(fork.Get<Body>(entities[42]).contacts == std::vector<int>(2, 42));
+        REQUIRE(fork.TryGet<Body>(entities[42]) != reg.TryGet<Body>(entities[42]));
+
+        // The tombstone left by entities[10] is reused the same way in both
+        const ent::Entity a = reg.CreateEntity();
+        const ent::Entity b = fork.CreateEntity();
+        REQUIRE(a == b);
+        REQUIRE(reg.TryGet<Body>(a) - reg.TryGet<Body>(entities[0]) == fork.TryGet<Body>(b) - fork.TryGet<Body>(entities[0]));
+    }
+}
+
+TEST_CASE("Registry: Fork shares chunks copy-on-write", "[Registry][Fork]")
+{
+    auto exercise = [](auto& reg) {
+        std::vector<ent::Entity> entities(4096);
+        reg.CreateEntities(entities);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            reg.template Set<Position>(entities[i], static_cast<float>(i), 0.0f, 0.0f);
+            reg.template Set<Team>(entities[i], Team(i % 4));
+        }
+        for (size_t i = 0; i < entities.size(); i += 7)
+            reg.DestroyEntity(entities[i]);
+
+        auto fork = reg.Fork();
+
+        // Const reads match and do not copy
+        const auto& cfork = fork;
+        for (size_t i = 1; i < entities.size(); i += 7)
+            REQUIRE(cfork.template Get<Position>(entities[i]).x == static_cast<float>(i));
+        REQUIRE(cfork.CountEqual(Team::Red) == reg.CountEqual(Team::Red));
+
+        // Diverge: writes in the fork are not seen by the original and vice versa
+        fork.template Get<Position>(entities[1]).x = -1.0f;
+        fork.template Set<Team>(entities[2], Team::Green);
+        reg.template Get<Position>(entities[3]).x = -3.0f;
+        REQUIRE(reg.template Get<Position>(entities[1]).x == 1.0f);
+        REQUIRE(reg.template Get<Team>(entities[2]) == Team::Blue);
+        REQUIRE(fork.template Get<Position>(entities[3]).x == 3.0f);
+
+        // Structural changes stay local too
+        fork.DestroyEntity(entities[5]);
+        const ent::Entity created = fork.CreateEntity();
+        REQUIRE(reg.IsValidEntity(entities[5]));
+        REQUIRE(reg.template Get<Position>(entities[5]).x == 5.0f);
+        REQUIRE(fork.Size() == reg.Size());
+        REQUIRE(fork.template Get<Position>(created).x == 0.0f);
+
+        size_t visited = 0;
+        reg.template Each<Position>([&](Position& p) { REQUIRE(p.x >= -3.0f); ++visited; });
+        REQUIRE(visited == reg.Size());
+
+        // Forking again from a fork works the same way
+        auto grandchild = fork.Fork();
+        grandchild.template Get<Position>(entities[1]).x = 10.0f;
+        REQUIRE(fork.template Get<Position>(entities[1]).x == -1.0f);
+    };
+
+    SECTION("Packed layout")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 256, .copyOnWrite = true }, Position, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Direct layout")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 256, .layout = ent::ColumnLayout::Direct,
+            .copyOnWrite = true }, Position, Team> reg;
+        exercise(reg);
+    }
+
+    SECTION("Only written chunks are copied")
+    {
+        using Reg = ent::Registry<ent::RegistryOptions{ .chunkSize = 256, .copyOnWrite = true }, Position, Velocity>;
+        Reg reg;
+        std::vector<ent::Entity> entities(256 * 16);
+        reg.CreateEntities(entities);
+
+        auto fork = reg.Fork();
+        const Reg& creg = reg;
+        const Reg& cfork = fork;
+        // Shared chunks show up as identical element addresses
+        auto shared = [&](auto component, size_t i) {
+            using C = decltype(component);
+            return &creg.Get<C>(entities[i]) == &cfork.Get<C>(entities[i]);
+        };
+        REQUIRE(shared(Position{}, 0));
+        REQUIRE(shared(Position{}, 4000));
+
+        fork.Get<Position>(entities[0]).x = 1.0f;
+        fork.Get<Position>(entities[300]).x = 1.0f;
+        REQUIRE(!shared(Position{}, 255));     // chunk 0 copied
+        REQUIRE(!shared(Position{}, 256));     // chunk 1 copied
+        REQUIRE(shared(Position{}, 512));      // the other 14 still shared
+        REQUIRE(shared(Position{}, 4000));
+        REQUIRE(shared(Velocity{}, 0));
+
+        fork.Each<Velocity>([](Velocity& v) { v.dx = 1.0f; });
+        REQUIRE(!shared(Velocity{}, 4000));
+        REQUIRE(reg.Get<Velocity>(entities[17]).dx == 0.0f);
+        REQUIRE(shared(Position{}, 4000));
+    }
+}
+
+TEST_CASE("Registry: unique IndexKey finds entities by key", "[Registry][Index]")
+{
+    using Reg = ent::RegistryWithDefaultChunkSize<Position, PlayerId>;
+    Reg reg;
+    std::vector<ent::Entity> entities(1000);
+    reg.CreateEntities(entities);
+
+    // Fresh entities hold the unset key and are not indexed
+    REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(0u)));
+    REQUIRE(reg.CountBy<PlayerId>(0u) == 0);
+
+    for (size_t i = 0; i < entities.size(); ++i)
+        reg.Set<PlayerId>(entities[i], static_cast<uint32_t>(i * 7 + 1));
+    for (size_t i = 0; i < entities.size(); ++i)
+        REQUIRE(reg.FindBy<PlayerId>(static_cast<uint32_t>(i * 7 + 1)) == entities[i]);
+    REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(2u)));
+
+    SECTION("Set re-keys, duplicates throw and change nothing")
+    {
+        reg.Set<PlayerId>(entities[3], 5000u);
+        REQUIRE(reg.FindBy<PlayerId>(5000u) == entities[3]);
+        REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(22u)));
+
+        REQUIRE_THROWS_AS(reg.Set<PlayerId>(entities[4], 5000u), std::runtime_error);
+        REQUIRE(reg.Get<PlayerId>(entities[4]).value == 29u);
+        REQUIRE(reg.FindBy<PlayerId>(29u) == entities[4]);
+
+        // Setting the unset key removes the entity from the index
+        reg.Set<PlayerId>(entities[3], 0u);
+        REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(5000u)));
+        reg.Set<PlayerId>(entities[4], 5000u);
+        REQUIRE(reg.FindBy<PlayerId>(5000u) == entities[4]);
+    }
+
+    SECTION("DestroyEntity unindexes and frees the key")
+    {
+        for (size_t i = 0; i < entities.size(); i += 3)
+            reg.DestroyEntity(entities[i]);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const ent::Entity found = reg.FindBy<PlayerId>(static_cast<uint32_t>(i * 7 + 1));
+            REQUIRE(found == (i % 3 == 0 ? ent::NullEntity : entities[i]));
+        }
+        // A recycled index starts unindexed; the freed key can be reused
+        const ent::Entity e = reg.CreateEntity();
+        REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(0u)));
+        reg.Set<PlayerId>(e, 1u);
+        REQUIRE(reg.FindBy<PlayerId>(1u) == e);
+    }
+
+    SECTION("Writes through references are picked up")
+    {
+        // Swap two keys behind the index's back
+        reg.Get<PlayerId>(entities[10]).value = 8u;
+        reg.Get<PlayerId>(entities[1]).value = 71u;
+        const Reg& creg = reg;
+        REQUIRE(creg.FindBy<PlayerId>(8u) == entities[10]);  // stale: scans
+        REQUIRE(reg.FindBy<PlayerId>(8u) == entities[10]);   // re-keys
+        REQUIRE(reg.FindBy<PlayerId>(71u) == entities[1]);
+
+        reg.Each<PlayerId>([](PlayerId& p) { p.value += 100000; });
+        REQUIRE(ent::IsNullEntity(creg.FindBy<PlayerId>(1u)));
+        REQUIRE(creg.FindBy<PlayerId>(100001u) == entities[0]);
+        reg.RefreshIndex<PlayerId>();
+        for (size_t i = 0; i < entities.size(); i += 97) {
+            const uint32_t key = creg.Get<PlayerId>(entities[i]).value;
+            REQUIRE(creg.FindBy<PlayerId>(key) == entities[i]);
+        }
+    }
+
+    SECTION("A key duplicated through a reference is linked once it is free")
+    {
+        const Reg& creg = reg;
+        reg.Get<PlayerId>(entities[1]).value = 1u;  // entities[0] holds 1
+        REQUIRE(reg.FindBy<PlayerId>(1u) == entities[0]);
+        REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(8u)));
+
+        reg.Set<PlayerId>(entities[0], 5000u);
+        REQUIRE(reg.FindBy<PlayerId>(1u) == entities[1]);
+        REQUIRE(creg.FindBy<PlayerId>(1u) == entities[1]);
+        REQUIRE(reg.FindBy<PlayerId>(5000u) == entities[0]);
+
+        // The key has an owner again: a third entity cannot take it
+        REQUIRE_THROWS_AS(reg.Set<PlayerId>(entities[2], 1u), std::runtime_error);
+        REQUIRE(reg.CountBy<PlayerId>(1u) == 1);
+    }
+
+    SECTION("Clone copies the index")
+    {
+        auto copy = reg.Clone();
+        reg.Set<PlayerId>(entities[0], 0u);
+        REQUIRE(copy.FindBy<PlayerId>(1u) == entities[0]);
+        REQUIRE(ent::IsNullEntity(reg.FindBy<PlayerId>(1u)));
+        REQUIRE(reg.MemoryStats().columns[1].index.allocatedBytes > 0);
+    }
+}
+
+TEST_CASE("Registry: multi-value IndexKey matches a column scan", "[Registry][Index]")
+{
+    auto exercise = [](auto& reg) {
+        const auto scan = [&](const std::string& name) {
+            std::set<ent::Entity> out;
+            for (const ent::Entity e : reg)
+                if (reg.IsValidEntity(e) && std::as_const(reg).template Get<Guild>(e).name == name) out.insert(e);
+            return out;
+        };
+        const auto lookup = [](auto& r, const std::string& name) {
+            std::set<ent::Entity> out;
+            r.template FindAllBy<Guild>(name, [&](ent::Entity e) { REQUIRE(out.insert(e).second); });
+            REQUIRE(r.template CountBy<Guild>(name) == out.size());
+            return out;
+        };
+        const std::string names[] = { "", "red", "blue", "green", "gold" };
+
+        std::mt19937 rng(11);
+        std::vector<ent::Entity> live;
+        for (int step = 0; step < 4000; ++step) {
+            const unsigned op = rng() % 8;
+            if (op < 3 || live.empty()) {
+                live.push_back(reg.CreateEntity());
+            } else if (op < 5) {
+                reg.template Set<Guild>(live[rng() % live.size()], names[rng() % 5]);
+            } else if (op < 6) {
+                reg.template Get<Guild>(live[rng() % live.size()]).name = names[rng() % 5];
+            } else {
+                const size_t i = rng() % live.size();
+                reg.DestroyEntity(live[i]);
+                live[i] = live.back();
+                live.pop_back();
+            }
+            if (step % 97 == 0) {
+                const std::string& name = names[1 + rng() % 4];
+                REQUIRE(lookup(std::as_const(reg), name) == scan(name));
+                REQUIRE(lookup(reg, name) == scan(name));
+                const ent::Entity any = reg.template FindBy<Guild>(name);
+                REQUIRE((ent::IsNullEntity(any) ? scan(name).empty() : scan(name).contains(any)));
+            }
+        }
+        REQUIRE(lookup(reg, "").empty());
+
+        reg.template Each<Guild>([](Guild& g) { if (g.name == "red") g.name = "blue"; });
+        REQUIRE(lookup(std::as_const(reg), "red").empty());
+        REQUIRE(lookup(reg, "blue") == scan("blue"));
+        const size_t blue = scan("blue").size();
+        auto copy = reg.Clone();
+        REQUIRE(copy.template CountBy<Guild>("blue") == blue);
+    };
+
+    SECTION("Packed layout")
+    {
+        ent::RegistryWithDefaultChunkSize<Position, Guild> reg;
+        exercise(reg);
+    }
+
+    SECTION("Direct layout")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 256, .layout = ent::ColumnLayout::Direct }, Position, Guild> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous storage")
+    {
+        ent::Registry<0, Guild, Position> reg;
+        exercise(reg);
+    }
+}
+
+TEST_CASE("Registry: OrderKey range scans match a sorted column scan", "[Registry][Index][Ordered]")
+{
+    auto exercise = [](auto& reg) {
+        using Match = std::pair<uint32_t, ent::Entity>;
+        // Expected result: live entities with lo <= tick < hi, by tick then entity index
+        const auto scan = [&](uint32_t lo, uint32_t hi) {
+            std::vector<Match> out;
+            for (const ent::Entity e : reg) {
+                if (!reg.IsValidEntity(e)) continue;
+                const uint32_t tick = std::as_const(reg).template Get<ExpireTime>(e).tick;
+                if (tick != 0 && lo <= tick && tick < hi) out.emplace_back(tick, e);
+            }
+            std::sort(out.begin(), out.end(), [](const Match& a, const Match& b) {
+                return a.first != b.first ? a.first < b.first : ent::EntityToIndex(a.second) < ent::EntityToIndex(b.second);
+            });
+            return out;
+        };
+        const auto range = [](auto& r, uint32_t lo, uint32_t hi) {
+            std::vector<Match> out;
+            r.template RangeEach<ExpireTime>(lo, hi, [&](ent::Entity e) {
+                out.emplace_back(std::as_const(r).template Get<ExpireTime>(e).tick, e);
+            });
+            return out;
+        };
+        const auto reversed = [](std::vector<Match> v) {
+            std::reverse(v.begin(), v.end());
+            return v;
+        };
+
+        std::mt19937 rng(5);
+        std::vector<ent::Entity> live;
+        for (int step = 0; step < 5000; ++step) {
+            const unsigned op = rng() % 8;
+            if (op < 3 || live.empty()) {
+                live.push_back(reg.CreateEntity());
+            } else if (op < 5) {
+                reg.template Set<ExpireTime>(live[rng() % live.size()], static_cast<uint32_t>(rng() % 300));
+            } else if (op < 6) {
+                reg.template Get<ExpireTime>(live[rng() % live.size()]).tick = static_cast<uint32_t>(rng() % 300);
+            } else {
+                const size_t i = rng() % live.size();
+                reg.DestroyEntity(live[i]);
+                live[i] = live.back();
+                live.pop_back();
+            }
+            if (step % 89 == 0) {
+                const uint32_t lo = static_cast<uint32_t>(rng() % 300);
+                const uint32_t hi = lo + static_cast<uint32_t>(rng() % 100);
+                REQUIRE(range(std::as_const(reg), lo, hi) == scan(lo, hi));  // stale: sorted scan
+                REQUIRE(range(reg, lo, hi) == scan(lo, hi));
+                std::vector<Match> down;
+                reg.template RangeEachReverse<ExpireTime>(lo, hi, [&](ent::Entity e) {
+                    down.emplace_back(std::as_const(reg).template Get<ExpireTime>(e).tick, e);
+                });
+                REQUIRE(down == reversed(scan(lo, hi)));
+            }
+        }
+
+        // Unbounded scans skip unset keys; early stop
+        std::vector<Match> all;
+        std::as_const(reg).template OrderedEach<ExpireTime>([&](ent::Entity e) {
+            all.emplace_back(std::as_const(reg).template Get<ExpireTime>(e).tick, e);
+        });
+        REQUIRE(all == scan(1, 1000));
+        std::vector<ent::Entity> top;
+        reg.template OrderedEachReverse<ExpireTime>([&](ent::Entity e) { top.push_back(e); return top.size() < 5; });
+        REQUIRE(top.size() == 5);
+        const auto expected = reversed(scan(1, 1000));
+        for (size_t i = 0; i < top.size(); ++i)
+            REQUIRE(top[i] == expected[i].second);
+        REQUIRE(range(reg, 50, 50).empty());
+        REQUIRE(range(reg, 60, 50).empty());
+
+        // Expiry: collect, then destroy
+        std::vector<ent::Entity> expired;
+        reg.template RangeEach<ExpireTime>(0u, 150u, [&](ent::Entity e) { expired.push_back(e); });
+        REQUIRE(expired.size() == scan(0, 150).size());
+        reg.DestroyEntities(expired);
+        REQUIRE(range(reg, 0, 150).empty());
+        REQUIRE(range(reg, 150, 300) == scan(150, 300));
+
+        // A sweep re-keys the whole column; the clone keeps its own index
+        const std::vector<Match> before = scan(150, 300);
+        auto copy = reg.Clone();
+        reg.template Each<ExpireTime>([](ExpireTime& t) { if (t.tick != 0) t.tick += 1000; });
+        REQUIRE(range(std::as_const(reg), 0, 1000).empty());
+        REQUIRE(range(reg, 1150, 1300).size() == before.size());
+        REQUIRE(range(copy, 150, 300) == before);
+    };
+
+    SECTION("Packed layout")
+    {
+        ent::RegistryWithDefaultChunkSize<Position, ExpireTime> reg;
+        exercise(reg);
+    }
+
+    SECTION("Direct layout")
+    {
+        ent::Registry<ent::RegistryOptions{ .chunkSize = 256, .layout = ent::ColumnLayout::Direct }, Position, ExpireTime> reg;
+        exercise(reg);
+    }
+
+    SECTION("Contiguous storage")
+    {
+        ent::Registry<0, ExpireTime, Position> reg;
+        exercise(reg);
+    }
+}
+
+TEST_CASE("Registry: IndexKey and OrderKey on one component", "[Registry][Index][Ordered]")
+{
+    ent::RegistryWithDefaultChunkSize<Position, Score> reg;
+    std::vector<ent::Entity> entities(200);
+    reg.CreateEntities(entities);
+    for (size_t i = 0; i < entities.size(); ++i)
+        reg.Set<Score>(entities[i], static_cast<int>(i % 50) - 25);
+
+    REQUIRE(reg.CountBy<Score>(10) == 4);
+    size_t negative = 0;
+    int last = -1000;
+    reg.RangeEach<Score>(-1000, 0, [&](ent::Entity e) {
+        const int value = std::as_const(reg).Get<Score>(e).value;
+        REQUIRE(value >= last);
+        last = value;
+        ++negative;
+    });
+    REQUIRE(negative == 100);
+
+    reg.Get<Score>(entities[10]).value = 99;
+    REQUIRE(reg.FindBy<Score>(99) == entities[10]);
+    int best = 0;
+    reg.OrderedEachReverse<Score>([&](ent::Entity e) { best = reg.Get<Score>(e).value; return false; });
+    REQUIRE(best == 99);
+
+    reg.DestroyEntity(entities[10]);
+    REQUIRE(ent::IsNullEntity(reg.FindBy<Score>(99)));
+    reg.OrderedEachReverse<Score>([&](ent::Entity e) { best = std::as_const(reg).Get<Score>(e).value; return false; });
+    REQUIRE(best == 24);
+    REQUIRE(reg.MemoryStats().columns[1].index.allocatedBytes > 0);
+}
@@ -0,0 +1,181 @@
+// Catch2 tests for OrderedChunkedArray correctness
+
+#include <catch2/catch_test_macros.hpp>
+#include <OrderedChunkedArray.hpp>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ent = entable;
+
+namespace {
+    template <class A, class V>
+    void RequireSame(const A& arr, const V& reference)
+    {
+        REQUIRE(arr.size() == reference.size());
+        REQUIRE(std::equal(arr.begin(), arr.end(), reference.begin(), reference.end()));
+        size_t i = 0;
+        arr.for_each_chunk([&](auto chunk) {
+            REQUIRE(!chunk.empty());
+            REQUIRE(chunk.size() <= A::chunk_size);
+            for (const auto& v : chunk) REQUIRE(v == reference[i++]);
+        });
+        REQUIRE(i == reference.size());
+    }
+}
+
+TEST_CASE("OrderedChunkedArray<int>: insert and erase preserve order", "[OrderedChunkedArray][order]")
+{
+    ent::OrderedChunkedArray<int, 8> arr;
+    std::vector<int> reference;
+    REQUIRE(arr.empty());
+    REQUIRE(arr.begin() == arr.end());
+
+    std::mt19937 rng(11);
+    for (int step = 0; step < 5000; ++step) {
+        const unsigned op = rng() % 10;
+        if (op < 6 || reference.empty()) {
+            const size_t idx = rng() % (reference.size() + 1);
+            arr.insert(idx, step);
+            reference.insert(reference.begin() + static_cast<std::ptrdiff_t>(idx), step);
+        } else if (op < 9) {
+            const size_t idx = rng() % reference.size();
+            arr.erase(idx);
+            reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(idx));
+        } else {
+            const size_t first = rng() % reference.size();
+            const size_t count = rng() % (std::min<size_t>(reference.size() - first, 40) + 1);
+            arr.erase(first, count);
+            reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(first),
+                            reference.begin() + static_cast<std::ptrdiff_t>(first + count));
+        }
+        if (step % 97 == 0) RequireSame(arr, reference);
+    }
+    RequireSame(arr, reference);
+    for (size_t i = 0; i < reference.size(); ++i)
+        REQUIRE(arr[i] == reference[i]);
+    REQUIRE(arr.front() == reference.front());
+    REQUIRE(arr.back() == reference.back());
+    REQUIRE_THROWS_AS(arr.at(reference.size()), std::out_of_range);
+
+    // Iterators walk backwards across chunk boundaries too.
+    std::vector<int> reversed;
+    for (auto it = arr.end(); it != arr.begin(); ) reversed.push_back(*--it);
+    REQUIRE(std::equal(reversed.rbegin(), reversed.rend(), reference.begin(), reference.end()));
+
+    arr.erase(0, arr.size());
+    REQUIRE(arr.empty());
+    REQUIRE(arr.chunk_count() == 0);
+}
+
+TEST_CASE("OrderedChunkedArray: chunks split and merge", "[OrderedChunkedArray][chunks]")
+{
+    ent::OrderedChunkedArray<int, 16> arr;
+
+    // push_back fills chunks completely instead of splitting them.
+    for (int i = 0; i < 64; ++i) arr.push_back(i);
+    REQUIRE(arr.chunk_count() == 4);
+
+    // Inserting into a full chunk splits it in halves.
+    arr.insert(3, -1);
+    REQUIRE(arr.chunk_count() == 5);
+    REQUIRE(arr[3] == -1);
+    REQUIRE(arr[4] == 3);
+
+    // A chunk boundary with room before it takes the element without shifting.
+    const int* sixteen = &arr[17];
+    REQUIRE(*sixteen == 16);
+    arr.insert(9, -2);  // goes into the first half, which has room
+    REQUIRE(&arr[18] == sixteen);
+
+    // Erasing most of the array merges what is left of neighbouring chunks.
+    arr.erase(0, 60);
+    REQUIRE(arr.size() == 6);
+    REQUIRE(arr.chunk_count() == 1);
+    REQUIRE(arr[0] == 58);
+    REQUIRE(arr.back() == 63);
+
+    // Erasing a range spanning whole chunks frees them.
+    for (int i = 0; i < 100; ++i) arr.push_back(i);
+    const size_t before = arr.chunk_count();
+    arr.erase(10, 64);
+    REQUIRE(arr.chunk_count() == before - 3);
+    REQUIRE(arr.size() == 42);
+    REQUIRE(arr[10] == 68);
+}
+
+TEST_CASE("OrderedChunkedArray: sorted insertion and binary search", "[OrderedChunkedArray][sorted]")
+{
+    ent::OrderedChunkedArray<int, 32> timers;
+    std::vector<int> reference;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 3000; ++i) {
+        const int deadline = static_cast<int>(rng() % 1000);
+        const size_t idx = timers.insert_sorted(deadline);
+        REQUIRE(timers[idx] == deadline);
+        reference.insert(std::upper_bound(reference.begin(), reference.end(), deadline), deadline);
+    }
+    RequireSame(timers, reference);
+
+    for (int key : { -5, 0, 1, 499, 500, 998, 999, 2000 }) {
+        REQUIRE(timers.lower_bound(key) == static_cast<size_t>(std::lower_bound(reference.begin(), reference.end(), key) - reference.begin()));
+        REQUIRE(timers.upper_bound(key) == static_cast<size_t>(std::upper_bound(reference.begin(), reference.end(), key) - reference.begin()));
+    }
+
+    // nth turns a search result into an iterator for walking a key range.
+    const auto first = timers.nth(timers.lower_bound(200));
+    const auto last = timers.nth(timers.lower_bound(250));
+    REQUIRE(std::equal(first, last,
+        std::lower_bound(reference.begin(), reference.end(), 200), std::lower_bound(reference.begin(), reference.end(), 250)));
+    REQUIRE(timers.nth(timers.size()) == timers.end());
+    REQUIRE(*std::prev(std::as_const(timers).nth(timers.size())) == reference.back());
+
+    // Expire everything before 300, as a timer wheel would each frame.
+    timers.erase(0, timers.lower_bound(300));
+    REQUIRE(timers.front() >= 300);
+    REQUIRE(std::is_sorted(timers.begin(), timers.end()));
+
+    // Custom ordering.
+    ent::OrderedChunkedArray<int, 8> descending;
+    for (int v : { 3, 9, 1, 7, 5, 9 }) descending.insert_sorted(v, std::greater<>{});
+    REQUIRE(std::is_sorted(descending.begin(), descending.end(), std::greater<>{}));
+    REQUIRE(descending.lower_bound(7, std::greater<>{}) == 2);
+}
+
+TEST_CASE("OrderedChunkedArray<string>: non-trivial elements", "[OrderedChunkedArray][non-trivial]")
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        ent::OrderedChunkedArray<std::shared_ptr<int>, 4> arr;
+        for (int i = 0; i < 50; ++i) arr.insert(static_cast<size_t>(i) / 2, tracker);
+        REQUIRE(tracker.use_count() == 51);
+        arr.erase(5, 30);
+        REQUIRE(tracker.use_count() == 21);
+        arr.pop_back();
+        REQUIRE(tracker.use_count() == 20);
+    }
+    REQUIRE(tracker.use_count() == 1);
+
+    ent::OrderedChunkedArray<std::string, 4> names;
+    std::vector<std::string> reference;
+    for (int i = 0; i < 40; ++i) {
+        std::string s = std::string(static_cast<size_t>(i % 3) * 20, 'x') + std::to_string(i);
+        names.insert_sorted(s);
+        reference.insert(std::upper_bound(reference.begin(), reference.end(), s), s);
+    }
+    RequireSame(names, reference);
+
+    auto copy = names.clone();
+    names.erase(0, 20);
+    RequireSame(copy, reference);
+
+    ent::OrderedChunkedArray<std::string, 4> moved(std::move(copy));
+    REQUIRE(moved.size() == 40);
+    REQUIRE(copy.empty());
+}
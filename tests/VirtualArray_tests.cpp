@@ -0,0 +1,177 @@
+// Catch2 tests for VirtualArray correctness
+
+#include <catch2/catch_test_macros.hpp>
+#include <VirtualArray.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ent = entable;
+
+// =============================================================================
+// Non-Empty Type Tests (comparing against std::vector)
+// =============================================================================
+
+TEST_CASE("VirtualArray<int>: push_back matches vector", "[VirtualArray][push_back]")
+{
+    ent::VirtualArray<int> arr;
+    std::vector<int> reference;
+
+    SECTION("Empty after construction")
+    {
+        REQUIRE(arr.empty());
+        REQUIRE(arr.size() == 0);
+        REQUIRE(arr.capacity() == 0);
+        REQUIRE(arr.data() == nullptr);
+    }
+
+    SECTION("Many elements across several commits")
+    {
+        for (int i = 0; i < 100000; ++i) {
+            arr.push_back(i);
+            reference.push_back(i);
+        }
+        REQUIRE(arr.size() == reference.size());
+        REQUIRE(arr.capacity() >= arr.size());
+        for (size_t i = 0; i < reference.size(); ++i)
+            REQUIRE(arr[i] == reference[i]);
+        REQUIRE(arr.back() == 99999);
+    }
+}
+
+TEST_CASE("VirtualArray<int>: growth never moves elements", "[VirtualArray][stability]")
+{
+    ent::VirtualArray<int> arr;
+    arr.push_back(7);
+    const int* first = &arr[0];
+    const int* data = arr.data();
+
+    for (int i = 0; i < 1 << 20; ++i)
+        arr.emplace_back(i);
+
+    REQUIRE(&arr[0] == first);
+    REQUIRE(arr.data() == data);
+    REQUIRE(arr[0] == 7);
+}
+
+TEST_CASE("VirtualArray<int>: resize, pop_back and iteration", "[VirtualArray][resize]")
+{
+    ent::VirtualArray<int> arr;
+
+    arr.resize(1000);
+    REQUIRE(arr.size() == 1000);
+    for (int v : arr) REQUIRE(v == 0);
+
+    arr.resize(1500, 3);
+    REQUIRE(arr[999] == 0);
+    REQUIRE(arr[1000] == 3);
+    REQUIRE(arr[1499] == 3);
+
+    arr.resize(10);
+    REQUIRE(arr.size() == 10);
+    arr.pop_back();
+    REQUIRE(arr.size() == 9);
+    REQUIRE(arr.span().size() == 9);
+    REQUIRE(std::distance(arr.begin(), arr.end()) == 9);
+
+    REQUIRE_THROWS_AS(arr.at(9), std::out_of_range);
+    REQUIRE(arr.at(8) == 0);
+}
+
+TEST_CASE("VirtualArray: shrink_to_fit decommits unused pages", "[VirtualArray][shrink_to_fit]")
+{
+    ent::VirtualArray<int> arr;
+    arr.resize(1 << 20);
+    const size_t committed = arr.committed_bytes();
+    REQUIRE(committed >= (size_t{1} << 20) * sizeof(int));
+
+    arr.resize(10);
+    REQUIRE(arr.committed_bytes() == committed);  // resize keeps pages like vector::capacity
+    const int* data = arr.data();
+    arr.shrink_to_fit();
+    REQUIRE(arr.committed_bytes() == ent::VirtualMemory::PageSize());
+    REQUIRE(arr.data() == data);
+
+    // Decommitted pages come back zeroed and usable
+    arr.resize(1 << 20);
+    REQUIRE(arr[(1 << 20) - 1] == 0);
+
+    arr.clear();
+    REQUIRE(arr.empty());
+    REQUIRE(arr.committed_bytes() > 0);
+    arr.shrink_to_fit();
+    REQUIRE(arr.committed_bytes() == 0);
+    REQUIRE(arr.data() == nullptr);
+}
+
+TEST_CASE("VirtualArray: reservation limit throws length_error", "[VirtualArray][max_size]")
+{
+    ent::VirtualArray<int, 64 * 1024> arr;
+    STATIC_REQUIRE(decltype(arr)::max_size() == 16 * 1024);
+    arr.resize(arr.max_size());
+    REQUIRE_THROWS_AS(arr.push_back(1), std::length_error);
+    REQUIRE(arr.size() == arr.max_size());
+
+    STATIC_REQUIRE(ent::reserve_bytes_for<int>(0) == 64 * 1024);
+    STATIC_REQUIRE(ent::reserve_bytes_for<int>(16 * 1024) == 64 * 1024);
+    STATIC_REQUIRE(ent::reserve_bytes_for<int>(16 * 1024 + 1) == 128 * 1024);
+}
+
+TEST_CASE("VirtualArray<string>: non-trivial elements are destroyed", "[VirtualArray][non-trivial]")
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        ent::VirtualArray<std::shared_ptr<int>> arr;
+        for (int i = 0; i < 100; ++i)
+            arr.push_back(tracker);
+        REQUIRE(tracker.use_count() == 101);
+        arr.resize(50);
+        REQUIRE(tracker.use_count() == 51);
+        arr.pop_back();
+        REQUIRE(tracker.use_count() == 50);
+    }
+    REQUIRE(tracker.use_count() == 1);
+
+    ent::VirtualArray<std::string> names;
+    names.emplace_back(40, 'x');
+    names.emplace_back("short");
+    REQUIRE(names[0] == std::string(40, 'x'));
+    REQUIRE(names[1] == "short");
+}
+
+TEST_CASE("VirtualArray: move transfers the reservation", "[VirtualArray][move]")
+{
+    ent::VirtualArray<int> a;
+    a.resize(100, 5);
+    const int* data = a.data();
+
+    ent::VirtualArray<int> b(std::move(a));
+    REQUIRE(b.data() == data);
+    REQUIRE(b.size() == 100);
+    REQUIRE(a.empty());
+    REQUIRE(a.data() == nullptr);
+
+    ent::VirtualArray<int> c;
+    c.push_back(1);
+    c = std::move(b);
+    REQUIRE(c.data() == data);
+    REQUIRE(c[99] == 5);
+}
+
+TEST_CASE("VirtualArray: clone copies into its own reservation", "[VirtualArray][clone]")
+{
+    ent::VirtualArray<std::string> a;
+    for (int i = 0; i < 1000; ++i)
+        a.emplace_back(std::to_string(i));
+
+    auto b = a.clone();
+    REQUIRE(b.size() == 1000);
+    REQUIRE(b.data() != a.data());
+    REQUIRE(b[999] == "999");
+    b[0] = "changed";
+    REQUIRE(a[0] == "0");
+
+    const ent::VirtualArray<int> empty;
+    REQUIRE(empty.clone().data() == nullptr);
+}